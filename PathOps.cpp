@@ -1,6 +1,8 @@
 // (c) 2023, Cary Clark cclark2@gmail.com
 #include "OpContour.h"
 #include "PathOps.h"
+#include <atomic>
+#include <thread>
 
 namespace PathOpsV0Lib {
 
@@ -16,12 +18,20 @@ Context* CreateContext() {
     return (Context*) contours;
 }
 
+Context* CreateContext(AllocatorCallBacks allocator) {
+    Context* context = CreateContext();
+    ((OpContours*) context)->allocator = allocator;
+    return context;
+}
+
 void Add(Contour* libContour, AddCurve curve) {
     OP_ASSERT(curve.points[0] != curve.points[1]);
     OpContour* contour = (OpContour*) libContour;
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
     debugGlobalContours = contour->contours;
 #endif
+    if (ContextError::memory == contour->contours->error)
+        return;  // storage is exhausted; resolve reports the error
     contour->segments.emplace_back(libContour, curve);
 }
 
@@ -56,6 +66,11 @@ ContextError Error(Context* context) {
     return contours->error;
 }
 
+ContextStats GetStats(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    return contours->stats;
+}
+
 void SetError(Context* context, ContextError error) {
     OpContours* contours = (OpContours*) context;
 	contours->error = error;
@@ -66,6 +81,21 @@ void SetErrorHandler(Context* context, ErrorDispatch errorDispatch) {
 	contours->errorHandler.errorDispatchFuncPtr = errorDispatch;
 }
 
+void SetPhaseHandler(Context* context, PhaseDispatch phaseDispatch) {
+    OpContours* contours = (OpContours*) context;
+	contours->phaseHandler.phaseDispatchFuncPtr = phaseDispatch;
+}
+
+void SetThreadCount(Context* context, unsigned threadCount) {
+    OpContours* contours = (OpContours*) context;
+    contours->threadCount = std::max(1u, threadCount);
+}
+
+void IncludeBounds(Context* context, OpRect bounds) {
+    OpContours* contours = (OpContours*) context;
+    contours->maxBounds.add(bounds);
+}
+
 void Normalize(Context* context) {
     OpContours* contours = (OpContours*) context;
     if (ContextError::none != contours->error) {
@@ -75,11 +105,37 @@ void Normalize(Context* context) {
 	contours->opsInit();
 }
 
+size_t PeakMemory(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    return contours->memoryPeak;
+}
+
+void ResetContext(Context* context) {
+    OpContours* contours = (OpContours*) context;
+#if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
+    debugGlobalContours = contours;
+#endif
+    contours->reset();
+}
+
 void ResetContour(Contour* c) {
     OpContour* contour = (OpContour*) c;
     contour->segments.clear();
 }
 
+void ReserveContour(Contour* c, size_t curveCount, size_t curveBytes) {
+    OpContour* contour = (OpContour*) c;
+    std::vector<OpSegment>& segments = contour->segments;
+    if (segments.capacity() < segments.size() + curveCount)  // keep geometric growth
+        segments.reserve(std::max(segments.size() + curveCount, segments.capacity() * 2));
+    contour->contours->reserveCurveData(curveBytes);
+}
+
+void ResetStats(Context* context) {
+    OpContours* contours = (OpContours*) context;
+    contours->stats = ContextStats();
+}
+
 void Resolve(Context* context, PathOutput output) {
     OpContours* contours = (OpContours*) context;
     if (ContextError::none != contours->error) {
@@ -92,6 +148,23 @@ void Resolve(Context* context, PathOutput output) {
 #endif
     // !!! change this to record error instead of success
     /* bool success = */ contours->pathOps();
+    contours->startPhase(ResolvePhase::none);  // ends last phase, including on early return
+}
+
+void ResolveAll(Context** contexts, PathOutput* outputs, size_t count, unsigned threadCount) {
+    std::atomic<size_t> nextIndex = 0;
+    auto resolveNext = [contexts, outputs, count, &nextIndex]() {
+        for (size_t index = nextIndex++; index < count; index = nextIndex++)
+            Resolve(contexts[index], outputs[index]);
+    };
+    if (threadCount > count)
+        threadCount = (unsigned) count;
+    std::vector<std::thread> threads;
+    for (unsigned index = 1; index < threadCount; ++index)
+        threads.emplace_back(resolveNext);
+    resolveNext();  // calling thread is the first worker
+    for (std::thread& thread : threads)
+        thread.join();
 }
 
 void SetContextCallBacks(Context* context, ContextCallBacks contextCallBacks) {
@@ -99,9 +172,15 @@ void SetContextCallBacks(Context* context, ContextCallBacks contextCallBacks) {
     contours->contextCallBacks = contextCallBacks;
 }
 
+void SetMemoryBudget(Context* context, size_t bytes) {
+    OpContours* contours = (OpContours*) context;
+    contours->memoryBudget = bytes;
+}
+
 CurveType SetCurveCallBacks(Context* context, CurveCallBacks curveCallBacks) {
     OpContours* contours = (OpContours*) context;
     contours->callBacks.push_back(curveCallBacks);
+    contours->builtInCurves.push_back(OpCurve::FindBuiltIn(curveCallBacks));
     return (CurveType) contours->callBacks.size();
 }
 
@@ -110,6 +189,7 @@ void SetWindingCallBacks(Contour* ctour, WindingCallBacks windingCallBacks) {
 	if (!windingCallBacks.windingSubtractFuncPtr)
 		windingCallBacks.windingSubtractFuncPtr = windingCallBacks.windingAddFuncPtr;
     contour->callBacks = windingCallBacks;
+    contour->builtIn = OpBuiltInWinding::Find(windingCallBacks);
 }
 
 } // namespace PathOpsV0Lib
@@ -9,6 +9,11 @@ namespace PathOpsV0Lib {
 // makes a PathOps context: an instance of the PathOps engine
 Context* CreateContext();
 
+// makes a PathOps context that gets its storage blocks from the caller's allocator
+// if the allocator returns nullptr, resolve stops with a memory error; blocks are never taken
+// from elsewhere, though the context itself holds a small reserve used while resolve stops
+Context* CreateContext(AllocatorCallBacks );
+
 // deletes a PathOps context, and frees any memory associated with that context
 void DeleteContext(Context* );
 
@@ -22,28 +27,71 @@ void Add(Contour* , Curve);
 // returns error code of previous call
 ContextError Error(Context* );
 
+// returns counts of work done; counts accumulate across resolves until reset
+ContextStats GetStats(Context* );
+
+// extends bounds used by normalize to choose thresholds; call before normalize
+// contexts resolving separate parts of one input include the whole input's bounds to match it
+void IncludeBounds(Context* , OpRect );
+
 // adjusts curves to place all numerical data in the same range
 void Normalize(Context* );
 
+// returns the most bytes held in storage blocks since the context was created or reset
+size_t PeakMemory(Context* );
+
+// removes all contours and clears any error; callbacks are unaffected
+// allocated memory is kept so that the next resolve need not allocate
+void ResetContext(Context* );
+
 // removes curves added to contour; callbacks are unaffected
 void ResetContour(Contour* );
 
+// makes room for curveCount more curves in contour, and curveBytes more curve data in context
+// optional; avoids reallocating as many curves are added
+void ReserveContour(Contour* , size_t curveCount, size_t curveBytes);
+
+// sets all counts returned by get stats to zero
+void ResetStats(Context* );
+
 // operate on added curves; calls curve output callback with path output
 void Resolve(Context* , PathOutput );
 
+// resolves count contexts on up to threadCount threads; contexts[i] writes to outputs[i]
+// each context's output and error are the same as calling Resolve on each in turn
+void ResolveAll(Context** contexts, PathOutput* outputs, size_t count, unsigned threadCount);
+
 // global callbacks
 void SetContextCallBacks(Context* , ContextCallBacks );
 
+// limits bytes held in storage blocks; a block that would exceed the limit is not allocated,
+// and resolve stops with ContextError::memory
+// zero (the default) sets no limit
+void SetMemoryBudget(Context* , size_t bytes);
+
 // sets the context into an error state
 void SetError(Context* , ContextError );
 
 // error callback; allows overriding error behavior
 void SetErrorHandler(Context* , ErrorDispatch );
 
+// phase callback; allows timing each step of resolve
+void SetPhaseHandler(Context* , PhaseDispatch );
+
+// intersects curve pairs on up to threadCount threads; one (the default) uses the calling thread
+// with more, curve pairs are intersected after line pairs, so output may differ slightly from one
+// thread, but is the same for any larger count; debug builds always use one thread
+// the cancel callback may be called from any of the threads, one at a time
+void SetThreadCount(Context* , unsigned threadCount);
+
 // curve callbacks; describes geometry between endpoints
+// if the callbacks are those of a curve in curves/ (line, quad, conic, cubic), the engine calls
+// that curve's functions directly instead of through the callbacks; see src/OpCurveSet.h
 CurveType SetCurveCallBacks(Context* , CurveCallBacks );
 
 // winding callbacks; specifies which curves are kept and discarded
+// if the callbacks are those of a winding in curves/ (unary, binary), the engine sums and keeps
+// windings directly instead of through the callbacks; see src/OpWindingSet.h
 void SetWindingCallBacks(Contour* , WindingCallBacks ); 
 
 }
@@ -19,7 +19,9 @@ enum class ContextError {
 	end,  // segment end does not connect to another segment
 	finite,  // curve points are not finite
 	intersection, // curve intersection error (should not occur)
+	memory,  // allocator callback did not supply a storage block
 	missing,  // results do not form closed loops
+	timeout,  // cancel callback stopped resolve before it completed
 	toVertical, // rotating / skewing curve (to intersect) exceeds floating point range
 	tree	// decision tree to join found edges is too complex
 };
@@ -196,6 +198,14 @@ typedef float (*MaxSignSwap)(Curve , Curve );
 typedef int (*MaxCurveCurve)(Curve , Curve );
 typedef int (*MaxLimbs)(Context* );
 
+// returns true if resolve should stop and report timeout (e.g., deadline passed)
+// polled between phases and inside curve-curve, winding, and join loops; should be fast
+typedef bool (*Cancel)(Context* );
+
+// if set, replaces per-curve output: receives each assembled closed contour at once, with
+// curves in output order; curve data is owned by the context and is valid until reset
+typedef void (*ContourOutput)(const Curve* curves, size_t count, PathOutput );
+
 struct ContextCallBacks {
 	SetLineType setLineTypeFuncPtr;
 	EmptyCallerPath emptyCallerPathFuncPtr = nullptr;
@@ -203,6 +213,50 @@ struct ContextCallBacks {
 	MaxCurveCurve maxDepthFuncPtr = nullptr;
 	MaxCurveCurve maxSplitsFuncPtr = nullptr;
 	MaxLimbs maxLimbsFuncPtr = nullptr;
+	Cancel cancelFuncPtr = nullptr;
+	ContourOutput contourOutputFuncPtr = nullptr;
+};
+
+// allocator callbacks
+
+// returns size bytes aligned for any type, or nullptr if no memory is available
+typedef void* (*AllocateBlock)(size_t size, void* allocatorData);
+
+// releases memory returned by allocate block
+typedef void (*FreeBlock)(void* block, void* allocatorData);
+
+struct AllocatorCallBacks {
+	AllocateBlock allocateBlockFuncPtr;
+	FreeBlock freeBlockFuncPtr = nullptr;  // may be null if caller releases all memory at once
+	void* allocatorData = nullptr;
+};
+
+// work counted since the context was created or its stats were reset; see GetStats
+struct ContextStats {
+	size_t segments;  // curves added to contours
+	size_t edges;  // segment parts between intersections
+	size_t intersections;
+	size_t coincidences;  // coincident runs found between segment pairs
+	size_t unsectables;  // segment pairs too close to intersect
+	size_t fillers;  // edges added to close gaps in output
+	size_t limbs;  // decision tree nodes tried while joining edges
+	size_t boundsPairs;  // segment pairs with nearby bounds checked for intersection
+	size_t curveCurvePairs;  // segment pairs subdivided to find intersections
+	// indexed by outcome: no, add, fail, intersects, maxOverlaps, noOverlapDeep, overflow, split
+	size_t curveCurveResults[8];
+	int curveCurveMaxDepth;  // deepest subdivision of any segment pair
+	size_t rayRetries;  // winding rays cast again from a different edge center
+	size_t rayEdges;  // edges tested for a crossing by winding rays
+	// indexed by reason: none, addCalcFail, addCalcFail2, filler, homeUnsectable, noMidT,
+	//   noNormal, rayTooShallow, tooManyTries, underflow; fillers are counted above
+	size_t unsortables[10];
+	// bytes of storage blocks allocated, by storage kind
+	size_t edgeBytes;
+	size_t curveDataBytes;
+	size_t contourBytes;
+	size_t sectBytes;
+	size_t limbBytes;
+	size_t callerBytes;
 };
 
 // return true if resolve should be aborted
@@ -212,6 +266,37 @@ struct ErrorHandler {
 	ErrorDispatch errorDispatchFuncPtr;
 };
 
+// phase callbacks
+
+// steps taken by resolve, in order; sort intersections runs more than once
+enum class ResolvePhase {
+	none,
+	discardDisjoint,
+	findCoincidences,
+	sortSegments,
+	findIntersections,
+	addDisjoint,
+	disableSmall,
+	sortIntersections,
+	fixCurveCurveSects,
+	findMissingEnds,
+	betweenIntersections,
+	makeEdges,
+	makeCoins,
+	transferCoins,
+	makePals,
+	setWindings,
+	apply,
+	assemble
+};
+
+// called as resolve begins and ends each phase; begin is false when the phase ends
+typedef void (*PhaseDispatch)(ResolvePhase , bool begin, Context* );
+
+struct PhaseHandler {
+	PhaseDispatch phaseDispatchFuncPtr;
+};
+
 } // namespace PathOpsV0Lib
 
 #endif
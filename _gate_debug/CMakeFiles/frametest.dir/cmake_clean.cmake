@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/frametest.dir/frametest.cpp.o"
+  "CMakeFiles/frametest.dir/frametest.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/PathOps.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/PathOps.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/debug/OpDebug.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpContour.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpContour.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpCurve.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpCurveCurve.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpEdge.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpIntersection.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpJoiner.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpMath.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpMath.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpSegment.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpSegments.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpWinder.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/src/OpWinding.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "CMakeFiles/frametest.dir/root/repo/tests/FrameTest.cpp.o"
+  "CMakeFiles/frametest.dir/root/repo/tests/FrameTest.cpp.o.d"
+  "frametest"
+  "frametest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/frametest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,41 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/path2Dtest.dir/path2Dtest.cpp.o"
+  "CMakeFiles/path2Dtest.dir/path2Dtest.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/PathOps.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/PathOps.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/debug/OpDebug.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/emscripten/Path2D.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/emscripten/Path2D.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpContour.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpContour.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpCurve.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpCurveCurve.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpEdge.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpIntersection.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpJoiner.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpMath.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpMath.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpSegment.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpSegments.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpWinder.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpWinding.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "CMakeFiles/path2Dtest.dir/root/repo/tests/Path2Dtest.cpp.o"
+  "CMakeFiles/path2Dtest.dir/root/repo/tests/Path2Dtest.cpp.o.d"
+  "path2Dtest"
+  "path2Dtest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/path2Dtest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
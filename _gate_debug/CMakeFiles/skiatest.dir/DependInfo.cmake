@@ -0,0 +1,62 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/PathOps.cpp" "CMakeFiles/skiatest.dir/root/repo/PathOps.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/PathOps.cpp.o.d"
+  "/root/repo/debug/OpDebug.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebug.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "/root/repo/debug/OpDebugColor.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugColor.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugColor.cpp.o.d"
+  "/root/repo/debug/OpDebugCompare.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugCompare.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugCompare.cpp.o.d"
+  "/root/repo/debug/OpDebugDouble.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugDouble.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugDouble.cpp.o.d"
+  "/root/repo/debug/OpDebugDump.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugDump.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugDump.cpp.o.d"
+  "/root/repo/debug/OpDebugGenerator.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugGenerator.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugGenerator.cpp.o.d"
+  "/root/repo/debug/OpDebugImage.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugImage.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugImage.cpp.o.d"
+  "/root/repo/debug/OpDebugRaster.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugRaster.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugRaster.cpp.o.d"
+  "/root/repo/debug/OpDebugRecord.cpp" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugRecord.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/debug/OpDebugRecord.cpp.o.d"
+  "/root/repo/skia/SkiaPaths.cpp" "CMakeFiles/skiatest.dir/root/repo/skia/SkiaPaths.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/skia/SkiaPaths.cpp.o.d"
+  "/root/repo/src/OpContour.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpContour.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpContour.cpp.o.d"
+  "/root/repo/src/OpCurve.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpCurve.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "/root/repo/src/OpCurveCurve.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpCurveCurve.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "/root/repo/src/OpEdge.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpEdge.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "/root/repo/src/OpIntersection.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpIntersection.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "/root/repo/src/OpJoiner.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpJoiner.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "/root/repo/src/OpMath.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpMath.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpMath.cpp.o.d"
+  "/root/repo/src/OpSegment.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpSegment.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "/root/repo/src/OpSegments.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpSegments.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "/root/repo/src/OpWinder.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpWinder.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "/root/repo/src/OpWinding.cpp" "CMakeFiles/skiatest.dir/root/repo/src/OpWinding.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "/root/repo/tests/OpSkiaTests.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/OpSkiaTests.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/OpSkiaTests.cpp.o.d"
+  "/root/repo/tests/OpV0Tests.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/OpV0Tests.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/OpV0Tests.cpp.o.d"
+  "/root/repo/tests/PathOpsBattles_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsBattles_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsBattles_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsChalkboardTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsChalkboardTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsChalkboardTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsFuzz763Test_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsFuzz763Test_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsFuzz763Test_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsInverseTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsInverseTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsInverseTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsIssue3651_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsIssue3651_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsIssue3651_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsOpCircleThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpCircleThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpCircleThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsOpCubicThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpCubicThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpCubicThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsOpLoopThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpLoopThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpLoopThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsOpRectThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpRectThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpRectThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsOpTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsOpTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyDegenerateThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyDegenerateThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyDegenerateThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyFailTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyFailTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyFailTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyQuadThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyQuadThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyQuadThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyQuadralateralsThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyQuadralateralsThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyQuadralateralsThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyRectThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyRectThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyRectThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsSimplifyTrianglesThreadedTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyTrianglesThreadedTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsSimplifyTrianglesThreadedTest_shim.cpp.o.d"
+  "/root/repo/tests/PathOpsTigerTest_shim.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsTigerTest_shim.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/PathOpsTigerTest_shim.cpp.o.d"
+  "/root/repo/tests/TinySkia.cpp" "CMakeFiles/skiatest.dir/root/repo/tests/TinySkia.cpp.o" "gcc" "CMakeFiles/skiatest.dir/root/repo/tests/TinySkia.cpp.o.d"
+  "/root/repo/cmake/skiatest.cpp" "CMakeFiles/skiatest.dir/skiatest.cpp.o" "gcc" "CMakeFiles/skiatest.dir/skiatest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,97 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/stresstest.dir/root/repo/PathOps.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/PathOps.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebug.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugColor.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugColor.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugCompare.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugCompare.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugDouble.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugDouble.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugDump.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugDump.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugGenerator.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugGenerator.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugImage.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugImage.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugRaster.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugRaster.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugRecord.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/debug/OpDebugRecord.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/skia/SkiaPaths.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/skia/SkiaPaths.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpContour.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpContour.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpCurve.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpCurveCurve.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpEdge.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpIntersection.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpJoiner.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpMath.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpMath.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpSegment.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpSegments.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpWinder.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpWinding.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/OpSkiaTests.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/OpSkiaTests.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/OpV0Tests.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/OpV0Tests.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsBattles_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsBattles_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsChalkboardTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsChalkboardTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsFuzz763Test_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsFuzz763Test_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsInverseTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsInverseTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsIssue3651_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsIssue3651_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpCircleThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpCircleThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpCubicThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpCubicThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpLoopThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpLoopThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpRectThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpRectThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsOpTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyDegenerateThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyDegenerateThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyFailTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyFailTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyQuadThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyQuadThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyQuadralateralsThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyQuadralateralsThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyRectThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyRectThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyTrianglesThreadedTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsSimplifyTrianglesThreadedTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsTigerTest_shim.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/PathOpsTigerTest_shim.cpp.o.d"
+  "CMakeFiles/stresstest.dir/root/repo/tests/TinySkia.cpp.o"
+  "CMakeFiles/stresstest.dir/root/repo/tests/TinySkia.cpp.o.d"
+  "CMakeFiles/stresstest.dir/skiatest.cpp.o"
+  "CMakeFiles/stresstest.dir/skiatest.cpp.o.d"
+  "stresstest"
+  "stresstest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/stresstest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,33 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/PathOps.cpp" "CMakeFiles/tinytest.dir/root/repo/PathOps.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/PathOps.cpp.o.d"
+  "/root/repo/debug/OpDebug.cpp" "CMakeFiles/tinytest.dir/root/repo/debug/OpDebug.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "/root/repo/src/OpContour.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpContour.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpContour.cpp.o.d"
+  "/root/repo/src/OpCurve.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpCurve.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "/root/repo/src/OpCurveCurve.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpCurveCurve.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "/root/repo/src/OpEdge.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpEdge.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "/root/repo/src/OpIntersection.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpIntersection.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "/root/repo/src/OpJoiner.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpJoiner.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "/root/repo/src/OpMath.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpMath.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpMath.cpp.o.d"
+  "/root/repo/src/OpSegment.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpSegment.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "/root/repo/src/OpSegments.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpSegments.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "/root/repo/src/OpWinder.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpWinder.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "/root/repo/src/OpWinding.cpp" "CMakeFiles/tinytest.dir/root/repo/src/OpWinding.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "/root/repo/tests/TestNewInterface.cpp" "CMakeFiles/tinytest.dir/root/repo/tests/TestNewInterface.cpp.o" "gcc" "CMakeFiles/tinytest.dir/root/repo/tests/TestNewInterface.cpp.o.d"
+  "/root/repo/cmake/tinytest.cpp" "CMakeFiles/tinytest.dir/tinytest.cpp.o" "gcc" "CMakeFiles/tinytest.dir/tinytest.cpp.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
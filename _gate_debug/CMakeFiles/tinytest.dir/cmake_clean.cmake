@@ -0,0 +1,39 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/tinytest.dir/root/repo/PathOps.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/PathOps.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/debug/OpDebug.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/debug/OpDebug.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpContour.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpContour.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpCurve.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpCurve.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpCurveCurve.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpCurveCurve.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpEdge.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpEdge.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpIntersection.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpIntersection.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpJoiner.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpJoiner.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpMath.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpMath.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpSegment.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpSegment.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpSegments.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpSegments.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpWinder.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpWinder.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpWinding.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/src/OpWinding.cpp.o.d"
+  "CMakeFiles/tinytest.dir/root/repo/tests/TestNewInterface.cpp.o"
+  "CMakeFiles/tinytest.dir/root/repo/tests/TestNewInterface.cpp.o.d"
+  "CMakeFiles/tinytest.dir/tinytest.cpp.o"
+  "CMakeFiles/tinytest.dir/tinytest.cpp.o.d"
+  "tinytest"
+  "tinytest.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/tinytest.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
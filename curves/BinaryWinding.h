@@ -93,6 +93,14 @@ inline void binaryWindingAddRightFunc(Winding winding, Winding toAdd) {
 //   if sum is zero, fill ends
 struct KeepData {
     KeepData(Winding winding, Winding sumWinding, void (KeepData::*FuncPtr)())
+        : KeepData(BinaryWinding(winding), BinaryWinding(sumWinding))
+    {
+        if (flips)
+            (this->*(FuncPtr))();
+    }
+
+    // the engine calls the operator directly for built-in windings if any operand flips
+    KeepData(BinaryWinding winding, BinaryWinding sumWinding)
         : bWind(winding)
         , bSum(sumWinding)
         , keep(WindKeep::Discard)
@@ -108,10 +116,8 @@ struct KeepData {
         right = windState(bWind.right, bSum.right);
 	    bool leftFlips = left == WindState::flipOff || left == WindState::flipOn;
 		bool rightFlips = right == WindState::flipOff || right == WindState::flipOn;
-        if (!leftFlips && !rightFlips)
-            return;
+        flips = leftFlips || rightFlips;
         bothFlip = leftFlips && rightFlips;
-        (this->*(FuncPtr))();
     }
 
     // !!! while true, it may be too confusing to associate this table with implementation
@@ -165,6 +171,7 @@ struct KeepData {
     WindState left;
     WindState right;
     WindKeep keep;
+    bool flips;
     bool bothFlip;
 };
 
@@ -132,27 +132,32 @@ inline size_t AddConics(Contour* contour, AddCurve curve) {
         return 1;
     }
     // control point is not inside bounds formed by end points; split Conic into parts
-    std::vector<float> tValues { 0, 1 };
-    auto addExtrema = [start, control, end, &tValues](XyChoice offset) {
+    // fixed arrays avoid allocating while adding many curves
+    float tValues[4] { 0, 1 };  // ends, and at most one extrema in x and one in y
+    int tCount = 2;
+    auto addExtrema = [start, control, end, &tValues, &tCount](XyChoice offset) {
         OpQuadCoefficients dc = DerivativeCoefficients(start, control, end, offset);
         OpRoots roots = OpMath::QuadRootsInteriorT(dc.a, dc.b, dc.c);
         OP_ASSERT(0 == roots.count() || 1 == roots.count());   // !!! I wanna see the extreme case...
         if (0 == roots.count())
             return;
-        tValues.push_back(roots.roots[0]);
+        tValues[tCount++] = roots.roots[0];
     };
     if (!monotonicInX)
         addExtrema(XyChoice::inX);
     if (!monotonicInY)
         addExtrema(XyChoice::inY);
-    std::sort(tValues.begin(), tValues.end());
-    std::vector<OpPtT> ptTs(tValues.size());
-    ptTs.front() = { start, 0 };
-    ptTs.back() = { end, 1 };
-    for (unsigned index = 1; index < tValues.size() - 1; ++index) {
+    for (int index = 1; index < tCount; ++index) {  // insertion sort few values
+        for (int back = index; back && tValues[back] < tValues[back - 1]; --back)
+            std::swap(tValues[back], tValues[back - 1]);
+    }
+    OpPtT ptTs[4];
+    ptTs[0] = { start, 0 };
+    ptTs[tCount - 1] = { end, 1 };
+    for (int index = 1; index < tCount - 1; ++index) {
         ptTs[index] = { ConicPointAtT(start, control, end, tValues[index]), tValues[index] }; 
     } 
-    size_t curvesAdded = tValues.size() - 1;
+    size_t curvesAdded = tCount - 1;
     for (unsigned index = 0; index < curvesAdded; ++index) {
         struct ConicData {
             OpPoint endPts[2];
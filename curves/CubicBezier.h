@@ -112,14 +112,16 @@ inline size_t AddCubics(Contour* contour, AddCurve curve) {
     OpPoint end = curve.points[1];
     CubicControls controls { curve.points[2], curve.points[3] };
     // control point is not inside bounds formed by end points; split cubic into parts
-    std::vector<float> tValues { 0, 1 };
-    auto addExtrema = [&tValues](float a, float b, float c, float d) {
+    // fixed arrays avoid allocating while adding many curves
+    float tValues[8] { 0, 1 };  // ends, two extrema each in x and y, and two inflections
+    int tCount = 2;
+    auto addExtrema = [&tValues, &tCount](float a, float b, float c, float d) {
         float A = d - a + 3 * (b - c);
         float B = 2 * (a - b - b + c);
         float C = b - a;
         OpRoots roots = OpMath::QuadRootsInteriorT(A, B, C);  // don't keep roots ~0, ~1
         for (int index = 0; index < roots.count(); ++index)
-            tValues.push_back(roots.roots[index]);
+            tValues[tCount++] = roots.roots[index];
     };
     addExtrema(start.x, controls.pts[0].x, controls.pts[1].x, end.x);
     addExtrema(start.y, controls.pts[0].y, controls.pts[1].y, end.y);
@@ -130,15 +132,18 @@ inline size_t AddCubics(Contour* contour, AddCurve curve) {
     OpRoots roots = OpMath::QuadRootsInteriorT(B.x * C.y - B.y * C.x, A.x * C.y - A.y * C.x,
             A.x * B.y - A.y * B.x);  // don't keep roots ~0, ~1
     for (int index = 0; index < roots.count(); ++index)
-        tValues.push_back(roots.roots[index]);
-    std::sort(tValues.begin(), tValues.end());
-    std::vector<OpPtT> ptTs(tValues.size());
-    ptTs.front() = { start, 0 };
-    ptTs.back() = { end, 1 };
-    for (unsigned index = 1; index < tValues.size() - 1; ++index) {
+        tValues[tCount++] = roots.roots[index];
+    for (int index = 1; index < tCount; ++index) {  // insertion sort few values
+        for (int back = index; back && tValues[back] < tValues[back - 1]; --back)
+            std::swap(tValues[back], tValues[back - 1]);
+    }
+    OpPtT ptTs[8];
+    ptTs[0] = { start, 0 };
+    ptTs[tCount - 1] = { end, 1 };
+    for (int index = 1; index < tCount - 1; ++index) {
         ptTs[index] = { CubicPointAtT(start, controls, end, tValues[index]), tValues[index] }; 
     } 
-    size_t curvesAdded = tValues.size() - 1;
+    size_t curvesAdded = tCount - 1;
     for (unsigned index = 0; index < curvesAdded; ++index) {
         OpPoint curveData[4] { ptTs[index].pt, ptTs[index + 1].pt };
         *(CubicControls*)&curveData[2] = CubicControlPt(start, controls, end, 
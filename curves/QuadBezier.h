@@ -64,28 +64,33 @@ inline size_t AddQuads(Contour* contour, AddCurve curve) {
         return 1;
     }
     // control point is not inside bounds formed by end points; split quad into parts
-    std::vector<float> tValues { 0, 1 };
-    auto addExtrema = [&tValues](float s, float c, float e) {
+    // fixed arrays avoid allocating while adding many curves
+    float tValues[4] { 0, 1 };  // ends, and at most one extrema in x and one in y
+    int tCount = 2;
+    auto addExtrema = [&tValues, &tCount](float s, float c, float e) {
         float numerator = s - c;
         float denominator = numerator - c + e;
         if (0 == denominator)
             return;
         float extrema = numerator / denominator;
         if (OpEpsilon <= extrema && extrema < 1)
-            tValues.push_back(extrema);
+            tValues[tCount++] = extrema;
     };
     if (!monotonicInX)
         addExtrema(start.x, control.x, end.x);
     if (!monotonicInY)
         addExtrema(start.y, control.y, end.y);
-    std::sort(tValues.begin(), tValues.end());
-    std::vector<OpPtT> ptTs(tValues.size());
-    ptTs.front() = { start, 0 };
-    ptTs.back() = { end, 1 };
-    for (unsigned index = 1; index < tValues.size() - 1; ++index) {
+    for (int index = 1; index < tCount; ++index) {  // insertion sort few values
+        for (int back = index; back && tValues[back] < tValues[back - 1]; --back)
+            std::swap(tValues[back], tValues[back - 1]);
+    }
+    OpPtT ptTs[4];
+    ptTs[0] = { start, 0 };
+    ptTs[tCount - 1] = { end, 1 };
+    for (int index = 1; index < tCount - 1; ++index) {
         ptTs[index] = { QuadPointAtT(start, control, end, tValues[index]), tValues[index] }; 
     } 
-    size_t curvesAdded = tValues.size() - 1;
+    size_t curvesAdded = tCount - 1;
     for (unsigned index = 0; index < curvesAdded; ++index) {
         if (ptTs[index].pt == ptTs[index + 1].pt)
             continue;
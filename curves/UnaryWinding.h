@@ -47,14 +47,16 @@ inline void unaryWindingAddFunc(Winding winding, Winding toAdd) {
 // if winding is non-zero:
 //   if sum equals winding, fill starts
 //   if sum is zero, fill ends
-inline WindKeep unaryWindingKeepFunc(Winding winding, Winding sumWinding) {
-    UnaryWinding wind(winding);
-    UnaryWinding sum(sumWinding);
+inline WindKeep unaryWindingKeep(UnaryWinding wind, UnaryWinding sum) {
     if (!wind.left || (sum.left && sum.left != wind.left))
          return WindKeep::Discard;
     return sum.left ? WindKeep::Start : WindKeep::End;
 }
 
+inline WindKeep unaryWindingKeepFunc(Winding winding, Winding sumWinding) {
+    return unaryWindingKeep(UnaryWinding(winding), UnaryWinding(sumWinding));
+}
+
 inline void unaryWindingSubtractFunc(Winding winding, Winding toSubtract) {
     UnaryWinding difference(winding);
     UnaryWinding subtrahend(toSubtract);
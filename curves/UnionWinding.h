@@ -0,0 +1,200 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef UnionWinding_DEFINED
+#define UnionWinding_DEFINED
+
+#include "PathOps.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace PathOpsV0Lib {
+
+// fill rules of every operand in one union; shared by all of the union's windings
+// the caller keeps this until resolve returns, then checks overflow
+struct UnionFillRules {
+	UnionFillRules(int count)
+		: rules(count, 0)
+		, inverseCount(0)
+		, overflow(false) {
+	}
+
+	// returns true if count of operand covers area
+	bool fills(int operand, int count) const {
+		bool covers = isEvenOdd(operand) ? count & 1 : !!count;
+		return covers != isInverse(operand);
+	}
+
+	bool isEvenOdd(int operand) const {
+		return rules[operand] & evenOddRule;
+	}
+
+	bool isInverse(int operand) const {
+		return rules[operand] & inverseRule;
+	}
+
+	void setFillRule(int operand, bool isEvenOdd, bool isInverse) {
+		rules[operand] = (isEvenOdd ? evenOddRule : 0) | (isInverse ? inverseRule : 0);
+		inverseCount += isInverse;
+	}
+
+	enum : uint8_t {
+		evenOddRule = 1,
+		inverseRule = 2,
+	};
+
+	std::vector<uint8_t> rules;  // one per operand
+	int inverseCount;  // operands that fill where their count is zero
+	bool overflow;  // set if a sum had more nonzero counts than a winding holds
+};
+
+// nonzero count of one operand
+struct UnionCount {
+	int operand;
+	int count;
+};
+
+// winding for the union of any number of operands, each with its own fill rule
+// holds nonzero counts only, sorted by operand, so its size does not depend on operand count
+// if more than MaxCounts operands overlap, sums are truncated and rules->overflow is set;
+// the caller resolves the operands again in smaller groups
+struct UnionWinding {
+	static constexpr int MaxCounts = 16;
+
+	UnionWinding(UnionFillRules* r)
+		: rules(r)
+		, used(0) {
+	}
+
+	// returns true if any operand fills area: either a listed count fills, or an inverse
+	// operand is not listed, so its count is zero
+	bool fills() const {
+		int inverseListed = 0;
+		bool listedFills = false;
+		for (int index = 0; index < used; ++index) {
+			int operand = counts[index].operand;
+			inverseListed += rules->isInverse(operand);
+			listedFills |= rules->fills(operand, counts[index].count);
+		}
+		return listedFills || inverseListed < rules->inverseCount;
+	}
+
+	// replaces counts with the nonzero counts of left plus sign times right
+	void merge(const UnionWinding& left, const UnionWinding& right, int sign) {
+		UnionCount result[MaxCounts];
+		int resultUsed = 0;
+		auto add = [this, &result, &resultUsed](int operand, int count) {
+			if (!count)
+				return;
+			if (MaxCounts == resultUsed) {
+				rules->overflow = true;
+				return;
+			}
+			result[resultUsed++] = { operand, count };
+		};
+		int l = 0;
+		int r = 0;
+		while (l < left.used || r < right.used) {
+			if (r == right.used
+					|| (l < left.used && left.counts[l].operand < right.counts[r].operand)) {
+				add(left.counts[l].operand, left.counts[l].count);
+				++l;
+			} else if (l == left.used || right.counts[r].operand < left.counts[l].operand) {
+				add(right.counts[r].operand, sign * right.counts[r].count);
+				++r;
+			} else {
+				add(left.counts[l].operand, left.counts[l].count + sign * right.counts[r].count);
+				++l;
+				++r;
+			}
+		}
+		std::memcpy(counts, result, sizeof(UnionCount) * resultUsed);
+		used = resultUsed;
+	}
+
+	// sets the count of one operand; used to give each operand's contour its winding
+	void setOnly(int operand, int count) {
+		counts[0] = { operand, count };
+		used = 1;
+	}
+
+	UnionFillRules* rules;
+	int used;
+	UnionCount counts[MaxCounts];
+};
+
+inline UnionWinding& unionWinding(Winding w) {
+	OP_ASSERT(w.size == sizeof(UnionWinding));
+	return *(UnionWinding*) w.data;
+}
+
+inline void unionWindingAddFunc(Winding winding, Winding toAdd) {
+	UnionWinding& sum = unionWinding(winding);
+	sum.merge(sum, unionWinding(toAdd), 1);
+}
+
+// normal (clockwise from vector direction) points to sum
+// the edge is kept if the union fills one side of it and not the other
+inline WindKeep unionWindingKeepFunc(Winding winding, Winding sumWinding) {
+	const UnionWinding& sum = unionWinding(sumWinding);
+	UnionWinding other(sum.rules);
+	other.merge(sum, unionWinding(winding), -1);
+	bool sumFills = sum.fills();
+	if (sumFills == other.fills())
+		return WindKeep::Discard;
+	return sumFills ? WindKeep::Start : WindKeep::End;
+}
+
+inline void unionWindingSubtractFunc(Winding winding, Winding toSubtract) {
+	UnionWinding& difference = unionWinding(winding);
+	difference.merge(difference, unionWinding(toSubtract), -1);
+}
+
+// visible if crossing the edge changes any operand's coverage
+inline bool unionWindingVisibleFunc(Winding winding) {
+	const UnionWinding& test = unionWinding(winding);
+	for (int index = 0; index < test.used; ++index) {
+		const UnionCount& entry = test.counts[index];
+		if (test.rules->isEvenOdd(entry.operand) ? entry.count & 1 : entry.count)
+			return true;
+	}
+	return false;
+}
+
+inline void unionWindingZeroFunc(Winding toZero) {
+	unionWinding(toZero).used = 0;
+}
+
+#if OP_DEBUG_DUMP
+// reads counts into existing data; fill rules are unchanged
+inline void unionWindingDumpInFunc(const char*& str, Winding winding) {
+	UnionWinding& wind = unionWinding(winding);
+	OpDebugRequired(str, "{");
+	wind.used = (int) OpDebugReadSizeT(str);
+	for (int index = 0; index < wind.used; ++index) {
+		wind.counts[index].operand = (int) OpDebugReadSizeT(str);
+		wind.counts[index].count = (int) OpDebugReadSizeT(str);
+	}
+	OpDebugRequired(str, "}");
+}
+
+inline std::string unionWindingDumpOutFunc(Winding winding) {
+	const UnionWinding& wind = unionWinding(winding);
+	std::string s = "{" + STR(wind.used);
+	for (int index = 0; index < wind.used; ++index)
+		s += ", " + STR(wind.counts[index].operand) + ", " + STR(wind.counts[index].count);
+	return s + "}";
+}
+#endif
+
+#if OP_DEBUG_IMAGE
+inline std::string unionWindingImageOutFunc(Winding winding, int index) {
+	const UnionWinding& wind = unionWinding(winding);
+	if (index >= wind.used)
+		return "-";
+	return STR(wind.counts[index].operand) + ":" + STR(wind.counts[index].count);
+}
+#endif
+
+}
+
+#endif
@@ -5,6 +5,8 @@
 #include <string>
 #ifdef _WIN32
 #include <windows.h>
+#else
+#include <chrono>
 #endif
 
 int debugPrecision = 8; // -1;		// minus one means unset
@@ -24,7 +26,7 @@ constexpr auto to_array(T&&... t)->std::array < V, sizeof...(T) > {
 #endif
 
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
-OpContours* debugGlobalContours;
+thread_local OpContours* debugGlobalContours;  // per thread so contexts may run concurrently
 #endif
 
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP || OP_TINY_SKIA
@@ -61,8 +63,8 @@ uint64_t OpInitTimer() {
     QueryPerformanceFrequency(&frequency);
     return frequency.QuadPart;
 #else
-// #error "unimplmented"
-    return 0;
+    using Period = std::chrono::steady_clock::period;
+    return Period::den / Period::num;
 #endif
 }
 
@@ -72,8 +74,7 @@ uint64_t OpReadTimer() {
     QueryPerformanceCounter(&time);
     return time.QuadPart;
 #else
-// #error "unimplmented"
-    return 0;
+    return std::chrono::steady_clock::now().time_since_epoch().count();
 #endif
 }
 
@@ -81,8 +82,7 @@ float OpTicksToSeconds(uint64_t diff, uint64_t frequency) {
 #ifdef _WIN32
     return (float) (diff * 1000000 / frequency) / 1000000;
 #else
-// #error "unimplmented"
-    return 0;
+    return (float) ((double) diff / frequency);
 #endif
 }
 
@@ -970,7 +970,7 @@ void OpWinder::debugValidate() const {
 #endif
 
 #if OP_DEBUG_DUMP
-std::string debugContext;
+thread_local std::string debugContext;
 
 void debugImage() {
 #if OP_DEBUG_IMAGE
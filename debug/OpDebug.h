@@ -260,7 +260,7 @@ struct OpDebugMaker {
 #endif
 
 #if OP_DEBUG_IMAGE || OP_DEBUG_DUMP
-extern OpContours* debugGlobalContours;
+extern thread_local OpContours* debugGlobalContours;
 extern bool debugHexFloat;
 extern void playback();
 extern void record();
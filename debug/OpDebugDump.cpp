@@ -14,8 +14,6 @@
 #include "OpWinder.h"
 #include "PathOps.h"
 
-int OpCurveCurve::debugCall;  // which call to curve-curve was made
-
 // !!! things to do:
 // decrement debug level (and indent) when dumping (for example) edges within an edge
 // allow more flexible abbreviations for labels (none, first letter, string)
@@ -2423,8 +2421,8 @@ void OpCurveCurve::dumpClosest(const OpPoint& originalPt) const {
     int iterations = 0;
     OpPointBounds eLast;
     OpPointBounds oLast;
-    const OpEdge* originalEdge = &seg->edges[0];
-    const OpEdge* originalOpp = &opp->edges[0];
+    const OpEdge* originalEdge = &segWhole;
+    const OpEdge* originalOpp = &oppWhole;
     do {
         ++iterations;
         dc_ex = tMatch(originalEdge, XyChoice::inX, bestOPtT.pt, exd, "ex");
@@ -3266,13 +3264,13 @@ std::string OpCurveCurve::debugDump(DebugLevel l, DebugBase b) const {
     if (DebugLevel::file == l)
         s += "seg:" + STR(seg->id) + " ";
     else {
-        const OpEdge* originalEdge = &seg->edges[0];
+        const OpEdge* originalEdge = &segWhole;
         s += "originalEdge:" + originalEdge->debugDump(down1, b) + "\n";
     }
     if (DebugLevel::file == l)
         s += "opp:" + STR(seg->id) + "\n";
     else {
-        const OpEdge* originalOpp = &opp->edges[0];
+        const OpEdge* originalOpp = &oppWhole;
         s += "originalOpp:" + originalOpp->debugDump(down1, b) + "\n";
     }
     if (DebugLevel::file == l) {
@@ -3977,8 +3975,7 @@ void OpWinding::dumpSet(const char*& str, OpContours* dumpContours) {
     OP_ASSERT(contour);
     OP_ASSERT(contourID == contour->id);
     OpDebugRequired(str, "w.size");
-    w.size = OpDebugReadSizeT(str);
-    w.data = contour->contours->allocateWinding(w.size);
+    allocate(OpDebugReadSizeT(str));
     OpDebugRequired(str, "[");
     for (size_t index = 0; index < w.size; ++index)
         ((uint8_t*) w.data)[index] = OpDebugByteToInt(str);
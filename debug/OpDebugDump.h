@@ -302,7 +302,7 @@ extern void dp(int id);
 
 // expand this as the need arises
 
-extern std::string debugContext;
+extern thread_local std::string debugContext;
 extern void debug();  // set debug bitmap to start and dump state using current context
 
 // used by new interface
@@ -64,12 +64,13 @@ struct Guiness {
 	float x;
 };
 
-std::vector<Fodder> data;
-bool recordPaused = false;
-bool recordCubic = false;
-bool recordAll = false;
-Guiness recordVert;
-Guiness recordSect;
+// per thread so recording does not race when tests run concurrently
+thread_local std::vector<Fodder> data;
+thread_local bool recordPaused = false;
+thread_local bool recordCubic = false;
+thread_local bool recordAll = false;
+thread_local Guiness recordVert;
+thread_local Guiness recordSect;
 
 void OpDebugRecordStart(const OpEdge& opp, const OpEdge& edge) {
 	OP_ASSERT(!recordPaused);
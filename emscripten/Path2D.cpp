@@ -628,6 +628,16 @@ static void CubicOutput(PathOpsV0Lib::Curve c, bool firstPt, bool lastPt, PathOu
 	output->commonOutput(c, Types::cubic, firstPt, lastPt);
 }
 
+// reserves the whole contour (move, curves, close) before appending
+static void PathContourOutput(const PathOpsV0Lib::Curve* curves, size_t count,
+		PathOutput pathOutput) {
+	OutPath* output = (OutPath*) pathOutput;
+	output->result.curves.reserve(output->result.curves.size() + count + 2);
+	for (size_t index = 0; index < count; ++index)
+		output->commonOutput(curves[index], (Types) curves[index].type, 0 == index,
+				count - 1 == index);
+}
+
 static PathOpsV0Lib::CurveType LineType(PathOpsV0Lib::Curve ) {
 	return (CurveType) Types::line;
 }
@@ -666,7 +676,8 @@ static void SetupCurves(Context* context) {
 
 ContextError FillPath::opCommon(FillPath& path, Ops oper) {
 	Context* context = CreateContext();
-	SetContextCallBacks(context, { LineType, EmptyFunc });	
+	SetContextCallBacks(context, { LineType, EmptyFunc, nullptr, nullptr, nullptr, nullptr,
+			nullptr, PathContourOutput });
 	SetupCurves(context);
 	int leftData[] = { 1, 0 };
 	Winding leftWinding { leftData, sizeof(leftData) };
@@ -683,7 +694,8 @@ ContextError FillPath::opCommon(FillPath& path, Ops oper) {
 
 ContextError FillPath::simplify() {
 	Context* context = CreateContext();
-	SetContextCallBacks(context, { LineType, EmptyFunc });	
+	SetContextCallBacks(context, { LineType, EmptyFunc, nullptr, nullptr, nullptr, nullptr,
+			nullptr, PathContourOutput });
 	SetupCurves(context);
     int simpleData[] = { 1 };
     Winding simpleWinding { simpleData, sizeof(simpleData) };
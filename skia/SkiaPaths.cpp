@@ -45,8 +45,13 @@ bool SkPathOpInvertOutput(SkPathOp op, bool leftOperandIsInverted, bool rightOpe
 #include "curves/CubicBezier.h"
 #include "curves/BinaryWinding.h"
 #include "curves/UnaryWinding.h"
+#include "curves/UnionWinding.h"
 
 #include "PathOps.h"
+#include <atomic>
+#include <cfloat>
+#include <cmath>
+#include <thread>
 
 using namespace PathOpsV0Lib;
 
@@ -117,6 +122,32 @@ enum class SkiaCurveType : int {
 	skiaCubicType
 };
 
+// maps curve types set by SetSkiaCurveCallBacks to the verbs their output callbacks emit
+static SkPath::Verb skiaVerb(CurveType type) {
+    switch ((SkiaCurveType) type) {
+        case SkiaCurveType::skiaLineType: return SkPath::kLine_Verb;
+        case SkiaCurveType::skiaQuadType: return SkPath::kQuad_Verb;
+        case SkiaCurveType::skiaConicType: return SkPath::kConic_Verb;
+        case SkiaCurveType::skiaCubicType: return SkPath::kCubic_Verb;
+    }
+    OP_ASSERT(0);
+    return SkPath::kDone_Verb;
+}
+
+// reserves points for the whole contour once, then appends its curves in order
+void skiaContourOutput(const Curve* curves, size_t count, PathOutput output) {
+    SkPath& skpath = *(SkPath*)(output);
+    int ptCount = 1;  // moveTo
+    for (size_t index = 0; index < count; ++index) {
+        SkPath::Verb verb = skiaVerb(curves[index].type);
+        ptCount += SkPath::kLine_Verb == verb ? 1 : SkPath::kCubic_Verb == verb ? 3 : 2;
+    }
+    skpath.incReserve(ptCount);
+    for (size_t index = 0; index < count; ++index)
+        commonOutput(curves[index], skiaVerb(curves[index].type), 0 == index,
+                count - 1 == index, output);
+}
+
 // start here;
 // rearrange to allow nullptr as default
 void SetSkiaCurveCallBacks(Context* context) {
@@ -300,7 +331,8 @@ void SetSkiaContextCallBacks(Context* context) {
 	if (DebugAnalyze(context))  // definition below
 		return;
 #endif
-    SetContextCallBacks(context, { setSkiaLineType, emptySkPathFunc });
+    SetContextCallBacks(context, { setSkiaLineType, emptySkPathFunc, nullptr, nullptr,
+            nullptr, nullptr, nullptr, skiaContourOutput });
 }
 
 Contour* SetSkiaSimplifyCallBacks(Context* context, Winding winding,
@@ -365,68 +397,507 @@ Contour* SetSkiaOpCallBacks(Context* context, Winding winding, SkPathOp op,
     return contour;
 }
 
+Contour* SetSkiaUnionCallBacks(Context* context, Winding winding  
+        OP_DEBUG_PARAMS(const SkPath& path)) {
+    Contour* contour = CreateContour(context, winding);
+    SetWindingCallBacks(contour, { unionWindingAddFunc, unionWindingKeepFunc, 
+            unionWindingVisibleFunc, unionWindingZeroFunc, unionWindingSubtractFunc });
+#if OP_DEBUG
+    SkiaSimplifyContourData unionUserData { OP_DEBUG_CODE(&path)  OP_DEBUG_IMAGE_PARAMS(true) };
+	SetDebugWindingCallBacks(contour, { &unionUserData, sizeof(unionUserData) }, noDebugBitOper
+            OP_DEBUG_DUMP_PARAMS(unionWindingDumpInFunc, unionWindingDumpOutFunc, unaryDumpFunc)
+            OP_DEBUG_IMAGE_PARAMS(unionWindingImageOutFunc, debugSimplifyPathFunc,
+	        debugSimplifyGetDrawFunc, debugSimplifySetDrawFunc, noIsOppFunc)
+    );
+#endif
+    return contour;
+}
+
+// adds the curve for one verb; pts[0] is the end of the previous curve
+// copies points to curve order: start, end, controls (conic weight follows control)
+// returns false when verb is done
+static bool addSkiaVerb(Contour* contour, SkPath::Verb verb, const SkPoint pts[4], float weight,
+		OpPoint closeLine[2]) {
+    auto opPt = [pts](int index) {
+        return OpPoint(pts[index].fX, pts[index].fY);
+    };
+    switch (verb) {
+    case SkPath::kMove_Verb:
+        if (closeLine[0] != closeLine[1])
+            Add(contour, { closeLine, sizeof(OpPoint) * 2, 
+					(CurveType) SkiaCurveType::skiaLineType } );
+        closeLine[0] = closeLine[1] = opPt(0);
+        return true;
+    case SkPath::kLine_Verb: {
+        OpPoint line[2] { opPt(0), opPt(1) };
+        if (line[0] != line[1])
+            Add(contour, { line, sizeof(line), (CurveType) SkiaCurveType::skiaLineType } );
+        closeLine[0] = line[1];
+        } return true;
+    case SkPath::kQuad_Verb: {
+        OpPoint quad[3] { opPt(0), opPt(2), opPt(1) };
+        AddQuads(contour, { quad, sizeof(quad), (CurveType) SkiaCurveType::skiaQuadType } );
+        closeLine[0] = quad[1];
+        } return true;
+    case SkPath::kConic_Verb: {
+        OpPoint conic[4] { opPt(0), opPt(2), opPt(1), { weight, 0 } };  // !!! hacky
+        AddConics(contour, { conic, sizeof(OpPoint) * 3 + sizeof(float), 
+                (CurveType) SkiaCurveType::skiaConicType } );
+        closeLine[0] = conic[1];
+        } return true;
+    case SkPath::kCubic_Verb: {
+        OpPoint cubic[4] { opPt(0), opPt(3), opPt(1), opPt(2) };  //  put start, end, up front
+        AddCubics(contour, { cubic, sizeof(cubic), (CurveType) SkiaCurveType::skiaCubicType } );
+        closeLine[0] = cubic[1];
+        } return true;
+    case SkPath::kClose_Verb:
+    case SkPath::kDone_Verb:
+        if (closeLine[0] != closeLine[1])
+            Add(contour, { closeLine, sizeof(OpPoint) * 2, 
+					(CurveType) SkiaCurveType::skiaLineType } );
+        closeLine[0] = closeLine[1];
+        return SkPath::kDone_Verb != verb;
+    default:
+        OP_ASSERT(0);
+    }
+    return false;
+}
+
 void AddSkiaPath(Context* context, Contour* contour, const SkPath& path) {
 	if (!path.isFinite()) {  // raw iter treats non-finite path as empty
 		SetError(context, ContextError::finite);
 		return;
 	}
+    int pointCount = path.countPoints();  // each curve adds about one point and one end point
+    ReserveContour(contour, pointCount, pointCount * sizeof(OpPoint) * 2);
     SkPath::RawIter iter(path);
     OpPoint closeLine[2] = {{0, 0}, {0, 0}};  // initialize so first move doesn't add close line
-    for (;;) {
+    SkPoint pts[4];
+    SkPath::Verb verb;
+    do {
+        verb = iter.next(pts);
+    } while (addSkiaVerb(contour, verb, pts, 
+            SkPath::kConic_Verb == verb ? iter.conicWeight() : 0, closeLine));
+}
+
+void AddSkiaPoints(Context* context, Contour* contour, const SkPoint* points, size_t pointCount,
+		const uint8_t* verbs, size_t verbCount, const float* conicWeights) {
+    for (size_t index = 0; index < pointCount; ++index) {
+        if (!OpPoint(points[index].fX, points[index].fY).isFinite()) {
+            SetError(context, ContextError::finite);
+            return;
+        }
+    }
+    ReserveContour(contour, verbCount, (pointCount + verbCount) * sizeof(OpPoint));
+    OpPoint closeLine[2] = {{0, 0}, {0, 0}};  // initialize so first move doesn't add close line
+    const SkPoint* next = points;
+    const SkPoint* last = points + pointCount;
+    SkPoint pts[4];
+    for (size_t index = 0; index < verbCount; ++index) {
+        SkPath::Verb verb = (SkPath::Verb) verbs[index];
+        int count = SkPath::kMove_Verb == verb || SkPath::kLine_Verb == verb ? 1
+                : SkPath::kQuad_Verb == verb || SkPath::kConic_Verb == verb ? 2
+                : SkPath::kCubic_Verb == verb ? 3 : 0;
+        // malformed arrays are reported like points that are not finite
+        if (last - next < count || (SkPath::kMove_Verb != verb && next == points)) {
+            SetError(context, ContextError::finite);
+            return;
+        }
+        if (SkPath::kMove_Verb == verb)
+            pts[0] = *next;
+        else if (SkPath::kClose_Verb != verb)
+            pts[0] = next[-1];
+        std::memcpy(&pts[SkPath::kMove_Verb != verb], next, count * sizeof(SkPoint));
+        next += count;
+        addSkiaVerb(contour, verb, pts, SkPath::kConic_Verb == verb ? *conicWeights++ : 0,
+                closeLine);
+    }
+    addSkiaVerb(contour, SkPath::kDone_Verb, pts, 0, closeLine);
+}
+
+// left and right supply fill types; add left and add right supply curves
+template <typename AddLeft, typename AddRight>
+ContextError skiaOpCommon(Context* context, const SkPath& left, const SkPath& right, SkPathOp op,
+        SkPath* result, AddLeft addLeft, AddRight addRight) {
+    SkPathOp mappedOp = MapInvertedSkPathOp(op, left.isInverseFillType(), 
+			right.isInverseFillType());
+    auto isWindingFill = [](const SkPath& path) {
+        return SkPathFillType::kWinding == path.getFillType()
+                || SkPathFillType::kInverseWinding == path.getFillType();
+    }; 
+    bool leftIsWinding = isWindingFill(left);
+    bool rightIsWinding = isWindingFill(right);
+    BinaryWindType windType = leftIsWinding && rightIsWinding ? BinaryWindType::windBoth
+            : leftIsWinding ? BinaryWindType::windLeft 
+			: rightIsWinding ? BinaryWindType::windRight : BinaryWindType::evenOdd;
+    int leftData[] = { 1, 0 };
+    Contour* leftContour = SetSkiaOpCallBacks(context, { leftData, sizeof(leftData) }, mappedOp, 
+			BinaryOperand::left, windType  OP_DEBUG_PARAMS(left));
+    addLeft(leftContour);
+    int rightData[] = { 0, 1 };
+    Contour* rightContour = SetSkiaOpCallBacks(context, { rightData, sizeof(rightData) }, mappedOp,
+			BinaryOperand::right, windType  OP_DEBUG_PARAMS(right));
+    addRight(rightContour);
+    Normalize(context);
+    Resolve(context, result);
+    if (SkPathOpInvertOutput(op, left.isInverseFillType(), right.isInverseFillType()))
+        result->toggleInverseFillType();
+    return Error(context);
+}
+
+ContextError SkiaOp(Context* context, const SkPath& left, const SkPath& right, SkPathOp op,
+		SkPath* result) {
+    return skiaOpCommon(context, left, right, op, result, [context, &left](Contour* contour) {
+        AddSkiaPath(context, contour, left);
+    }, [context, &right](Contour* contour) {
+        AddSkiaPath(context, contour, right);
+    });
+}
+
+ContextError SkiaUnion(Context* context, const SkPath* paths, size_t count, SkPath* result) {
+    if (!count) {
+        emptySkPathFunc(result);
+        return ContextError::none;
+    }
+    UnionFillRules rules((int) count);
+    bool inverseOutput = false;
+    for (size_t index = 0; index < count; ++index) {
+        SkPathFillType fillType = paths[index].getFillType();
+        bool isEvenOdd = SkPathFillType::kEvenOdd == fillType 
+                || SkPathFillType::kInverseEvenOdd == fillType;
+        rules.setFillRule((int) index, isEvenOdd, paths[index].isInverseFillType());
+        inverseOutput |= paths[index].isInverseFillType();  // area outside all operands fills
+    }
+    UnionWinding unionWinding(&rules);
+    Winding winding { &unionWinding, sizeof(unionWinding) };
+    for (size_t index = 0; index < count; ++index) {
+        unionWinding.setOnly((int) index, 1);  // segments copy winding as they are added
+        Contour* contour = SetSkiaUnionCallBacks(context, winding  OP_DEBUG_PARAMS(paths[index]));
+        AddSkiaPath(context, contour, paths[index]);
+    }
+    Normalize(context);
+    Resolve(context, result);
+    if (rules.overflow) {  // too many operands overlap to count; union each half, then both
+        SkPath halves[2];
+        size_t half = count / 2;
+        ResetContext(context);
+        ContextError error = SkiaUnion(context, paths, half, &halves[0]);
+        if (ContextError::none != error)
+            return error;
+        ResetContext(context);
+        error = SkiaUnion(context, paths + half, count - half, &halves[1]);
+        if (ContextError::none != error)
+            return error;
+        ResetContext(context);
+        result->reset();  // discard output of the resolve that overflowed
+        return SkiaUnion(context, halves, 2, result);
+    }
+    if (inverseOutput)
+        result->toggleInverseFillType();
+    return Error(context);
+}
+
+void SkiaOpBatch(const SkPath* left, const SkPath* right, const SkPathOp* ops, SkPath* results, 
+		ContextError* errors, size_t count, unsigned threadCount) {
+    std::atomic<size_t> nextIndex = 0;
+    auto opNext = [=, &nextIndex]() {
+        Context* context = nullptr;
+        for (size_t index = nextIndex++; index < count; index = nextIndex++) {
+            if (context)
+                ResetContext(context);
+            else {
+                context = CreateContext();
+                SetSkiaContextCallBacks(context);
+                SetSkiaCurveCallBacks(context);
+            }
+            errors[index] = SkiaOp(context, left[index], right[index], ops[index], 
+                    &results[index]);
+        }
+        if (context)
+            DeleteContext(context);
+    };
+    if (threadCount > count)
+        threadCount = (unsigned) count;
+    std::vector<std::thread> threads;
+    for (unsigned index = 1; index < threadCount; ++index)
+        threads.emplace_back(opNext);
+    opNext();  // calling thread is the first worker
+    for (std::thread& thread : threads)
+        thread.join();
+}
+
+// contours of a path copied to arrays laid out as add Skia points reads them
+struct SkiaContours {
+    struct Span {
+        size_t point;  // index of first point, verb, and weight of contour
+        size_t verb;
+        size_t weight;
+        SkRect bounds;  // includes control points
+    };
+
+    // returns false if path has a curve that does not start where the previous curve ended
+    bool add(const SkPath& path) {
+        SkPath::RawIter iter(path);
         SkPoint pts[4];
-        SkPath::Verb verb = iter.next(pts);
-        switch (verb) {
-        case SkPath::kMove_Verb:
-            if (closeLine[0] != closeLine[1])
-                Add(contour, { closeLine, sizeof(closeLine), 
-						(CurveType) SkiaCurveType::skiaLineType } );
-            closeLine[1] = { pts[0].fX, pts[0].fY };
-            pts[1] = pts[0];
-            break;
-        case SkPath::kLine_Verb:
-            if (pts[0] != pts[1])
-                Add(contour, { (OpPoint*) pts, sizeof(SkPoint) * 2, 
-						(CurveType) SkiaCurveType::skiaLineType } );
-            break;
-        case SkPath::kQuad_Verb:
-            std::swap(pts[1], pts[2]);  // rearrange order from 0/1/2 to 0/2/1
-            AddQuads(contour, { (OpPoint*) pts, sizeof(SkPoint) * 3, 
-					(CurveType) SkiaCurveType::skiaQuadType } );
-            break;
-        case SkPath::kConic_Verb:
-            std::swap(pts[1], pts[2]);  // rearrange order from 0/1/2 to 0/2/1
-            pts[3].fX = iter.conicWeight(); // !!! hacky
-            AddConics(contour, { (OpPoint*) pts, sizeof(SkPoint) * 3 + sizeof(float), 
-                    (CurveType) SkiaCurveType::skiaConicType } );
-            break;
-        case SkPath::kCubic_Verb: {
-		#if 0
-			// This fails in GCC 13.2 release. It works in MSVS Visual C++ 2022 debug/release,
-			// clang debug/release, GCC 13.2 debug. Replacing std::swap with temp=a, a=b, b=temp
-			// also fails. Changing the indices also fails.
-            std::swap(pts[1], pts[2]);  // rearrange order from 0/1/2/3 to 0/3/1/2
-            std::swap(pts[1], pts[3]);
-		#else
-			SkPoint temp[4] { pts[0], pts[3], pts[1], pts[2] };  //  put start, end, up front
-			std::memcpy(pts, temp, sizeof(temp));
-		#endif
-            AddCubics(contour, { (OpPoint*) pts, sizeof(SkPoint) * 4, 
-					(CurveType) SkiaCurveType::skiaCubicType } );
-            } break;
-        case SkPath::kClose_Verb:
-        case SkPath::kDone_Verb:
-            if (closeLine[0] != closeLine[1])
-                Add(contour, { closeLine, sizeof(closeLine), 
-						(CurveType) SkiaCurveType::skiaLineType } );
-            if (SkPath::kDone_Verb == verb)
-                return;
-            closeLine[0] = closeLine[1];
-            continue;
-        default:
-            OP_ASSERT(0);
+        SkPath::Verb verb;
+        while (SkPath::kDone_Verb != (verb = iter.next(pts))) {
+            if (SkPath::kMove_Verb == verb) {
+                spans.push_back({ points.size(), verbs.size(), weights.size(), 
+                        { pts[0].fX, pts[0].fY, pts[0].fX, pts[0].fY } });
+                points.push_back(pts[0]);
+                verbs.push_back((uint8_t) verb);
+                continue;
+            }
+            if (spans.empty())
+                return false;
+            verbs.push_back((uint8_t) verb);
+            if (SkPath::kClose_Verb == verb)
+                continue;
+            if (!(pts[0] == points.back()))
+                return false;
+            int count = SkPath::kLine_Verb == verb ? 1 : SkPath::kCubic_Verb == verb ? 3 : 2;
+            SkRect& bounds = spans.back().bounds;
+            for (int index = 1; index <= count; ++index) {
+                bounds.fLeft = std::min(bounds.fLeft, pts[index].fX);
+                bounds.fTop = std::min(bounds.fTop, pts[index].fY);
+                bounds.fRight = std::max(bounds.fRight, pts[index].fX);
+                bounds.fBottom = std::max(bounds.fBottom, pts[index].fY);
+                points.push_back(pts[index]);
+            }
+            if (SkPath::kConic_Verb == verb)
+                weights.push_back(iter.conicWeight());
         }
-        closeLine[0] = { pts[1].fX, pts[1].fY };
+        return true;
+    }
+
+    // appends contour to path
+    void append(size_t contour, SkPath* path) const {
+        bool last = contour + 1 == spans.size();
+        size_t verbEnd = last ? verbs.size() : spans[contour + 1].verb;
+        const SkPoint* pt = &points[spans[contour].point];
+        const float* weight = weights.data() + spans[contour].weight;
+        for (size_t index = spans[contour].verb; index < verbEnd; ++index) {
+            switch ((SkPath::Verb) verbs[index]) {
+                case SkPath::kMove_Verb: path->moveTo(pt[0]); pt += 1; break;
+                case SkPath::kLine_Verb: path->lineTo(pt[0]); pt += 1; break;
+                case SkPath::kQuad_Verb: path->quadTo(pt[0], pt[1]); pt += 2; break;
+                case SkPath::kConic_Verb: path->conicTo(pt[0], pt[1], *weight++); pt += 2; break;
+                case SkPath::kCubic_Verb: path->cubicTo(pt[0], pt[1], pt[2]); pt += 3; break;
+                case SkPath::kClose_Verb: path->close(); break;
+                default: OP_ASSERT(0);
+            }
+        }
+    }
+
+    // copies contour to the end of arrays in out
+    void copy(size_t contour, SkiaContours& out) const {
+        const Span& span = spans[contour];
+        bool last = contour + 1 == spans.size();
+        size_t pointEnd = last ? points.size() : spans[contour + 1].point;
+        size_t verbEnd = last ? verbs.size() : spans[contour + 1].verb;
+        size_t weightEnd = last ? weights.size() : spans[contour + 1].weight;
+        out.points.insert(out.points.end(), &points[span.point], points.data() + pointEnd);
+        out.verbs.insert(out.verbs.end(), &verbs[span.verb], verbs.data() + verbEnd);
+        out.weights.insert(out.weights.end(), weights.data() + span.weight, 
+                weights.data() + weightEnd);
+    }
+
+    void reset() {
+        points.clear();
+        verbs.clear();
+        weights.clear();
+        spans.clear();
+    }
+
+    std::vector<SkPoint> points;
+    std::vector<uint8_t> verbs;
+    std::vector<float> weights;
+    std::vector<Span> spans;
+};
+
+ContextError SkiaOpTiled(const SkPath& left, const SkPath& right, SkPathOp op, SkPath* result,
+        unsigned threadCount, int tilesPerSide) {
+    SkiaContours operands[2];
+    auto untiled = [&]() {
+        Context* context = CreateContext();
+        SetSkiaContextCallBacks(context);
+        SetSkiaCurveCallBacks(context);
+        ContextError error = SkiaOp(context, left, right, op, result);
+        DeleteContext(context);
+        return error;
+    };
+    if (left.isInverseFillType() || right.isInverseFillType() || !left.isFinite() 
+            || !right.isFinite() || !operands[0].add(left) || !operands[1].add(right))
+        return untiled();
+    if (tilesPerSide <= 0)
+        tilesPerSide = std::min(64, (int) std::sqrt((float) (operands[0].verbs.size() 
+                + operands[1].verbs.size()) / 4096));
+    // thresholds depend on bounds; every tile includes the bounds of both operands to match
+    SkRect all = left.getBounds();
+    all.join(right.getBounds());
+    if (tilesPerSide <= 1 || all.fRight <= all.fLeft || all.fBottom <= all.fTop)
+        return untiled();
+    OpRect wholeBounds { all.fLeft, all.fTop, all.fRight, all.fBottom };
+    // the engine joins edges closer than its threshold; treat nearby output as on a seam
+    float margin = std::max({ 1.f, fabsf(all.fLeft), fabsf(all.fTop), fabsf(all.fRight), 
+            fabsf(all.fBottom), all.fRight - all.fLeft, all.fBottom - all.fTop }) 
+            * OpEpsilon * 256;
+    std::vector<float> xBorders(tilesPerSide + 1), yBorders(tilesPerSide + 1);
+    for (int index = 0; index < tilesPerSide; ++index) {
+        xBorders[index] = all.fLeft + (all.fRight - all.fLeft) * index / tilesPerSide;
+        yBorders[index] = all.fTop + (all.fBottom - all.fTop) * index / tilesPerSide;
+    }
+    xBorders[tilesPerSide] = all.fRight;
+    yBorders[tilesPerSide] = all.fBottom;
+    size_t tileCount = (size_t) (tilesPerSide * tilesPerSide);
+    auto tileRect = [&xBorders, &yBorders, tilesPerSide](size_t tile) {
+        int x = (int) tile % tilesPerSide;
+        int y = (int) tile / tilesPerSide;
+        return SkRect { xBorders[x], yBorders[y], xBorders[x + 1], yBorders[y + 1] };
+    };
+    // each tile lists the contours of each operand whose bounds touch it
+    auto firstTile = [tilesPerSide](float value, const std::vector<float>& borders) {
+        return std::min(tilesPerSide - 1, (int) (std::lower_bound(borders.begin() + 1, 
+                borders.end(), value) - borders.begin() - 1));
+    };
+    auto lastTile = [tilesPerSide](float value, const std::vector<float>& borders) {
+        return std::max(0, (int) (std::upper_bound(borders.begin(), borders.end() - 1, value)
+                - borders.begin() - 1));
+    };
+    std::vector<std::vector<size_t>> tileContours[2];
+    for (int operand : { 0, 1 }) {
+        tileContours[operand].resize(tileCount);
+        for (size_t contour = 0; contour < operands[operand].spans.size(); ++contour) {
+            const SkRect& b = operands[operand].spans[contour].bounds;
+            for (int y = firstTile(b.fTop, yBorders); y <= lastTile(b.fBottom, yBorders); ++y) {
+                for (int x = firstTile(b.fLeft, xBorders); x <= lastTile(b.fRight, xBorders); ++x)
+                    tileContours[operand][y * tilesPerSide + x].push_back(contour);
+            }
+        }
+    }
+    // each tile resolves its operands clipped to the tile; clipping cuts curves at its borders.
+    // Contours in the tile whose bounds touch no interior border are final. Contours that touch
+    // one are collected per tile, and merged with their neighbors across seams at the end
+    std::vector<SkPath> finals(tileCount), seams(tileCount);
+    std::vector<ContextError> errors(tileCount, ContextError::none);
+    std::atomic<size_t> nextIndex = 0;
+    auto opNext = [&]() {
+        Context* context = nullptr;
+        SkiaContours local[2];
+        SkiaContours output;
+        for (size_t tile = nextIndex++; tile < tileCount; tile = nextIndex++) {
+            const SkRect bounds = tileRect(tile);
+            bool crosses[2] = { false, false };
+            for (int operand : { 0, 1 }) {
+                local[operand].reset();
+                for (size_t contour : tileContours[operand][tile]) {
+                    const SkRect& b = operands[operand].spans[contour].bounds;
+                    crosses[operand] |= b.fLeft < bounds.fLeft || b.fTop < bounds.fTop
+                            || b.fRight > bounds.fRight || b.fBottom > bounds.fBottom;
+                    operands[operand].copy(contour, local[operand]);
+                }
+            }
+            if (local[0].verbs.empty() && local[1].verbs.empty())
+                continue;
+            auto resolve = [&context, &wholeBounds](const SkPath& l, const SkPath& r, 
+                    SkPathOp o, SkPath* out, auto addLeft, auto addRight) {
+                if (context)
+                    ResetContext(context);
+                else {
+                    context = CreateContext();
+                    SetSkiaContextCallBacks(context);
+                    SetSkiaCurveCallBacks(context);
+                }
+                return skiaOpCommon(context, l, r, o, out, addLeft, 
+                        [&context, &addRight, &wholeBounds](Contour* contour) {
+                    addRight(contour);
+                    IncludeBounds(context, wholeBounds);
+                });
+            };
+            auto addLocal = [&context](const SkiaContours& contours) {
+                return [&context, &contours](Contour* contour) {
+                    AddSkiaPoints(context, contour, contours.points.data(), 
+                            contours.points.size(), contours.verbs.data(), 
+                            contours.verbs.size(), contours.weights.data());
+                };
+            };
+            auto addPath = [&context](const SkPath& path) {
+                return [&context, &path](Contour* contour) {
+                    AddSkiaPath(context, contour, path);
+                };
+            };
+            SkPath clipped[2], tileResult;
+            ContextError error = ContextError::none;
+            if (crosses[0] || crosses[1]) {
+                SkPath clip;
+                clip.addRect(bounds);
+                for (int operand : { 0, 1 }) {
+                    error = resolve(operand ? right : left, clip, kIntersect_SkPathOp, 
+                            &clipped[operand], addLocal(local[operand]), addPath(clip));
+                    if (ContextError::none != error)
+                        break;
+                }
+                if (ContextError::none == error)
+                    error = resolve(clipped[0], clipped[1], op, &tileResult, 
+                            addPath(clipped[0]), addPath(clipped[1]));
+            } else
+                error = resolve(left, right, op, &tileResult, addLocal(local[0]), 
+                        addLocal(local[1]));
+            errors[tile] = error;
+            if (ContextError::none != error)
+                continue;
+            output.reset();
+            if (!output.add(tileResult)) {
+                seams[tile] = tileResult;
+                continue;
+            }
+            finals[tile].setFillType(tileResult.getFillType());
+            seams[tile].setFillType(tileResult.getFillType());
+            int x = (int) tile % tilesPerSide;
+            int y = (int) tile / tilesPerSide;
+            for (size_t contour = 0; contour < output.spans.size(); ++contour) {
+                const SkRect& b = output.spans[contour].bounds;
+                bool onSeam = (x > 0 && b.fLeft <= bounds.fLeft + margin)
+                        || (y > 0 && b.fTop <= bounds.fTop + margin)
+                        || (x + 1 < tilesPerSide && b.fRight >= bounds.fRight - margin)
+                        || (y + 1 < tilesPerSide && b.fBottom >= bounds.fBottom - margin);
+                output.append(contour, onSeam ? &seams[tile] : &finals[tile]);
+            }
+        }
+        if (context)
+            DeleteContext(context);
+    };
+    if (threadCount > tileCount)
+        threadCount = (unsigned) tileCount;
+    std::vector<std::thread> threads;
+    for (unsigned index = 1; index < threadCount; ++index)
+        threads.emplace_back(opNext);
+    opNext();  // calling thread is the first worker
+    for (std::thread& thread : threads)
+        thread.join();
+    for (ContextError error : errors) {
+        if (ContextError::none != error)
+            return untiled();
+    }
+    // tile results abut along seams; their union cancels the edges they share
+    std::vector<SkPath> seamPaths;
+    for (SkPath& seam : seams) {
+        if (!seam.isEmpty())
+            seamPaths.push_back(seam);
     }
+    SkPath merged;
+    Context* context = CreateContext();
+    SetSkiaContextCallBacks(context);
+    SetSkiaCurveCallBacks(context);
+    ContextError error = SkiaUnion(context, seamPaths.data(), seamPaths.size(), &merged);
+    DeleteContext(context);
+    if (ContextError::none != error)
+        return untiled();
+    emptySkPathFunc(result);
+    for (const SkPath& tileFinal : finals)
+        result->addPath(tileFinal);
+    result->addPath(merged);
+    return ContextError::none;
 }
 
 #if OP_DEBUG
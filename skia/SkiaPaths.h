@@ -3,7 +3,10 @@
 #include "PathOps.h"
 #include "SkiaEnumSkPathOp.h"
 
+#include <cstdint>
+
 class SkPath;
+struct SkPoint;
 
 namespace PathOpsV0Lib {
 
@@ -27,9 +30,35 @@ void SetSkiaContextCallBacks(PathOpsV0Lib::Context* );
 void SetSkiaCurveCallBacks(PathOpsV0Lib::Context* );
 PathOpsV0Lib::Contour* SetSkiaSimplifyCallBacks(PathOpsV0Lib::Context* , PathOpsV0Lib::Winding , 
 		bool isWindingFill  OP_DEBUG_PARAMS(const SkPath& ));
+PathOpsV0Lib::Contour* SetSkiaUnionCallBacks(PathOpsV0Lib::Context* , PathOpsV0Lib::Winding 
+		OP_DEBUG_PARAMS(const SkPath& ));
 PathOpsV0Lib::Contour* SetSkiaOpCallBacks(PathOpsV0Lib::Context* , PathOpsV0Lib::Winding , SkPathOp op, 
 		PathOpsV0Lib::BinaryOperand , PathOpsV0Lib::BinaryWindType  OP_DEBUG_PARAMS(const SkPath&));
 void AddSkiaPath(PathOpsV0Lib::Context* , PathOpsV0Lib::Contour* , const SkPath& path);
+// adds curves from arrays laid out like SkPath's: verbs holds SkPath::Verb values; move and line
+// use one point, quad and conic two, cubic three, close none; each conic uses one weight
+void AddSkiaPoints(PathOpsV0Lib::Context* , PathOpsV0Lib::Contour* , const SkPoint* points, 
+		size_t pointCount, const uint8_t* verbs, size_t verbCount, const float* conicWeights);
+
+// computes left op right into result; context must have Skia callbacks set and no contours
+PathOpsV0Lib::ContextError SkiaOp(PathOpsV0Lib::Context* , const SkPath& left, const SkPath& right, 
+		SkPathOp op, SkPath* result);
+// computes the union of count paths into result with one resolve, like SkOpBuilder given only
+// union ops; each path keeps its fill type; context must have Skia callbacks set and no contours
+// if more than UnionWinding::MaxCounts paths overlap, each half is resolved, then their union
+PathOpsV0Lib::ContextError SkiaUnion(PathOpsV0Lib::Context* , const SkPath* paths, size_t count,
+		SkPath* result);
+// computes left op right like skia op, but on a grid of tiles over the bounds of both operands;
+// each tile clips the operands to its bounds and resolves in its own context on up to threadCount
+// threads, then output that touches a seam between tiles is merged with a union
+// tilesPerSide of zero chooses the grid from the curve count; inverse fill types, and inputs too
+// small to tile, are resolved without tiling, as are inputs if any tile reports an error
+PathOpsV0Lib::ContextError SkiaOpTiled(const SkPath& left, const SkPath& right, SkPathOp op, 
+		SkPath* result, unsigned threadCount, int tilesPerSide = 0);
+// computes left[i] ops[i] right[i] into results[i] and errors[i] on up to threadCount threads
+// each thread creates one context and resets it between ops
+void SkiaOpBatch(const SkPath* left, const SkPath* right, const SkPathOp* ops, SkPath* results, 
+		PathOpsV0Lib::ContextError* errors, size_t count, unsigned threadCount);
 
 #if TEST_ANALYZE
 // used to break down tests that are too large to debug directly
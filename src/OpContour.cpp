@@ -6,20 +6,66 @@
 #include "OpWinder.h"
 #include "PathOps.h"
 
+thread_local OpThreadStorage* OpContours::threadStorage = nullptr;
+
+// Storage blocks come from the caller's allocator if one was passed to CreateContext. If the
+// allocator has no more memory, this returns nullptr and the context reports a memory error;
+// the caller then takes what it needs from the reserve, and the engine stops at the next check.
+// A block that would exceed the memory budget is refused the same way.
+template <typename T>
+T* OpContours::allocateBlock(size_t& chainBytes) {
+	if (memoryBudget && memoryUsed + sizeof(T) > memoryBudget) {
+		setError(PathOpsV0Lib::ContextError::memory  OP_DEBUG_PARAMS(0));
+		return nullptr;
+	}
+	T* block = nullptr;
+	if (allocator.allocateBlockFuncPtr) {
+		void* memory = allocator.allocateBlockFuncPtr(sizeof(T), allocator.allocatorData);
+		if (!memory) {
+			setError(PathOpsV0Lib::ContextError::memory  OP_DEBUG_PARAMS(0));
+			return nullptr;
+		}
+		block = new (memory) T;
+		block->callerOwned = true;
+	} else
+		block = new T;
+	chainBytes += sizeof(T);
+	memoryUsed += sizeof(T);
+	memoryPeak = std::max(memoryPeak, memoryUsed);
+	return block;
+}
+
+template <typename T>
+void OpContours::freeBlock(T* block) {
+	OP_ASSERT(memoryUsed >= sizeof(T));
+	memoryUsed -= sizeof(T);
+	if (!block->callerOwned) {
+		delete block;
+		return;
+	}
+	block->~T();
+	if (allocator.freeBlockFuncPtr)
+		allocator.freeBlockFuncPtr(block, allocator.allocatorData);
+}
+
 char* OpContours::allocateCallerData(size_t size) {
-	if (!callerStorage)
-		callerStorage = new CallerDataStorage;
-	if (callerStorage->used + size > sizeof(callerStorage->storage)) {
-		CallerDataStorage* next = new CallerDataStorage;
-		next->next = callerStorage;
-		callerStorage = next;
-	}
-	char* result = &callerStorage->storage[callerStorage->used];
+	CallerDataStorage*& storage = threadStorage ? threadStorage->callerStorage : callerStorage;
+	if (!storage || storage->used + size > sizeof(storage->storage)) {
+		auto lock = lockBlocks();
+		CallerDataStorage* next = callerSpare;
+		if (next)
+			callerSpare = next->next;
+		else if (!(next = allocateBlock<CallerDataStorage>(stats.callerBytes)))
+			return reserve.callerData(size);
+		next->next = storage;
+		storage = next;
+	}
+	char* result = &storage->storage[storage->used];
 	size_t alignSize = alignof(void*);  // !!! allow caller to specify this?
 	size_t alignPart = size % alignSize;
 	if (alignPart)
 		size += alignSize - alignPart;  // round up to next alignment
-	callerStorage->used += size;
+	storage->used += size;
 	return result;
 }
 
@@ -198,15 +244,18 @@ SegPt OpPtAliases::addIfClose(OpPoint match) {
 	}
 	for (const OpPtAlias& alias : maps) {
 		if (alias.original.isNearly(match, threshold)) {
-			add(match, alias.alias);
-			return { alias.alias, PtType::original };
+			OpPoint found = alias.alias;  // add may reallocate maps
+			add(match, found);
+			return { found, PtType::original };
 		}
 	}
 	return { match, PtType::noMatch };
 }
 
 OpContours::OpContours()
-	: errorHandler({nullptr})
+	: allocator({nullptr})
+	, errorHandler({nullptr})
+	, phaseHandler({nullptr})
 	, ccStorage(nullptr)
 	, curveDataStorage(nullptr)
 	, contourStorage(nullptr)
@@ -216,7 +265,19 @@ OpContours::OpContours()
 	, limbStorage(nullptr)
 	, limbCurrent(nullptr)
 	, callerStorage(nullptr)
+	, edgeSpare(nullptr)
+	, curveDataSpare(nullptr)
+	, contourSpare(nullptr)
+	, sectSpare(nullptr)
+	, limbSpare(nullptr)
+	, callerSpare(nullptr)
+	, memoryBudget(0)
+	, memoryUsed(0)
+	, memoryPeak(0)
+	, threadCount(1)
+	, stats()
 	, error(PathOpsV0Lib::ContextError::none)
+	, phase(PathOpsV0Lib::ResolvePhase::none)
 	, uniqueID(0) 
 	, outputOne(false)
 	OP_DEBUG_PARAMS(debugData(false)) {
@@ -236,6 +297,7 @@ OpContours::OpContours()
 	debugInClearEdges = false;
 	debugCheckLastEdge = false;
 	debugFailOnEqualCepts = false;
+	OP_DEBUG_DUMP_CODE(debugCurveCurveCall = 0);
 	OP_DEBUG_DUMP_CODE(debugDumpInit = false);
 #endif
 #if TEST_RASTER
@@ -244,32 +306,13 @@ OpContours::OpContours()
 }
 
 OpContours::~OpContours() {
-	release(ccStorage);
-	while (curveDataStorage) {
-		CurveDataStorage* next = curveDataStorage->next;
-		delete curveDataStorage;
-		curveDataStorage = next;
-	}
-	while (contourStorage) {
-		OpContourStorage* next = contourStorage->next;
-		delete contourStorage;
-		contourStorage = next;
-	}
-	release(fillerStorage);
-	while (sectStorage) {
-		OpSectStorage* next = sectStorage->next;
-		delete sectStorage;
-		sectStorage = next;
-	}
+	reset();
+	releaseSpares();
 	if (limbStorage) {
-		limbStorage->reset();
-		delete limbStorage;
-	}
-	while (callerStorage) {
-		CallerDataStorage* next = callerStorage->next;
-		delete callerStorage;
-		callerStorage = next;
+		OP_ASSERT(!limbStorage->nextBlock);  // reset moved older blocks to spare list
+		freeBlock(limbStorage);
 	}
+	OP_ASSERT(!memoryUsed);
 #if OP_DEBUG
 	debugInPathOps = false;
 	debugInClearEdges = false;
@@ -282,6 +325,36 @@ OpContours::~OpContours() {
 #endif
 }
 
+// frees blocks kept by reset for reuse
+void OpContours::releaseSpares() {
+	release(edgeSpare);
+	while (curveDataSpare) {
+		CurveDataStorage* next = curveDataSpare->next;
+		freeBlock(curveDataSpare);
+		curveDataSpare = next;
+	}
+	while (contourSpare) {
+		OpContourStorage* next = contourSpare->next;
+		freeBlock(contourSpare);
+		contourSpare = next;
+	}
+	while (sectSpare) {
+		OpSectStorage* next = sectSpare->next;
+		freeBlock(sectSpare);
+		sectSpare = next;
+	}
+	while (limbSpare) {
+		OpLimbStorage* next = limbSpare->nextBlock;
+		freeBlock(limbSpare);
+		limbSpare = next;
+	}
+	while (callerSpare) {
+		CallerDataStorage* next = callerSpare->next;
+		freeBlock(callerSpare);
+		callerSpare = next;
+	}
+}
+
 bool OpContours::addAlias(OpPoint pt, OpPoint alias) {
 	   if (!aliases.add(pt, alias)) {
 		   remapPts(pt, alias);
@@ -293,6 +366,7 @@ bool OpContours::addAlias(OpPoint pt, OpPoint alias) {
 OpEdge* OpContours::addFiller(const OpPtT& start, const OpPtT& end) {
 	void* block = allocateEdge(fillerStorage);
 	OpEdge* filler = new(block) OpEdge(this, start, end  OP_LINE_FILE_PARGS());
+	++stats.fillers;
 	return filler;
 }
 
@@ -301,10 +375,12 @@ void OpContours::addToBounds(const OpCurve& curve) {
 }
 
 OpContour* OpContours::allocateContour() {
-	if (!contourStorage)
-		contourStorage = new OpContourStorage;
-	if (contourStorage->used == ARRAY_COUNT(contourStorage->storage)) {
-		OpContourStorage* next = new OpContourStorage;
+	if (!contourStorage || contourStorage->used == ARRAY_COUNT(contourStorage->storage)) {
+		OpContourStorage* next = contourSpare;
+		if (next)
+			contourSpare = next->next;
+		else if (!(next = allocateBlock<OpContourStorage>(stats.contourBytes)))
+			return reserve.contour();
 		next->next = contourStorage;
 		contourStorage = next;
 	}
@@ -312,10 +388,13 @@ OpContour* OpContours::allocateContour() {
 }
 
 OpEdge* OpContours::allocateEdge(OpEdgeStorage*& edgeStorage) {
-	if (!edgeStorage)
-		edgeStorage = new OpEdgeStorage;
-	if (edgeStorage->used == ARRAY_COUNT(edgeStorage->storage)) {
-		OpEdgeStorage* next = new OpEdgeStorage;
+	if (!edgeStorage || edgeStorage->used == ARRAY_COUNT(edgeStorage->storage)) {
+		auto lock = lockBlocks();
+		OpEdgeStorage* next = edgeSpare;
+		if (next)
+			edgeSpare = next->next;
+		else if (!(next = allocateBlock<OpEdgeStorage>(stats.edgeBytes)))
+			return reserve.edge();
 		next->next = edgeStorage;
 		edgeStorage = next;
 	}
@@ -323,22 +402,28 @@ OpEdge* OpContours::allocateEdge(OpEdgeStorage*& edgeStorage) {
 }
 
 PathOpsV0Lib::CurveData* OpContours::allocateCurveData(size_t size) {
-	if (!curveDataStorage)
-		curveDataStorage = new CurveDataStorage;
-	if (curveDataStorage->used + size > sizeof(curveDataStorage->storage)) {
-		CurveDataStorage* next = new CurveDataStorage;
-		next->next = curveDataStorage;
-		curveDataStorage = next;
+	CurveDataStorage*& storage = curveData();
+	if (!storage || storage->used + size > sizeof(storage->storage)) {
+		auto lock = lockBlocks();
+		CurveDataStorage* next = curveDataSpare;
+		if (next)
+			curveDataSpare = next->next;
+		else if (!(next = allocateBlock<CurveDataStorage>(stats.curveDataBytes)))
+			return reserve.curveData(size);
+		next->next = storage;
+		storage = next;
 	}
-	return curveDataStorage->curveData(size);
+	return storage->curveData(size);
 }
 
 OpIntersection* OpContours::allocateIntersection() {
-	if (!sectStorage)
-		sectStorage = new OpSectStorage;
-	if (sectStorage->used == ARRAY_COUNT(sectStorage->storage)) {
-		OpSectStorage* next = new OpSectStorage;
-		OP_ASSERT(!next->next);
+	++stats.intersections;
+	if (!sectStorage || sectStorage->used == ARRAY_COUNT(sectStorage->storage)) {
+		OpSectStorage* next = sectSpare;
+		if (next)
+			sectSpare = next->next;
+		else if (!(next = allocateBlock<OpSectStorage>(stats.sectBytes)))
+			return reserve.sect();
 		next->next = sectStorage;
 		sectStorage = next;
 	}
@@ -346,8 +431,15 @@ OpIntersection* OpContours::allocateIntersection() {
 }
 
 OpLimb* OpContours::allocateLimb() {
+	++stats.limbs;
+	if (!limbStorage)  // first block could not be allocated
+		return reserve.limb();
 	if (limbStorage->used == ARRAY_COUNT(limbStorage->storage)) {
-		OpLimbStorage* next = new OpLimbStorage;
+		OpLimbStorage* next = limbSpare;
+		if (next)
+			limbSpare = next->nextBlock;
+		else if (!(next = allocateBlock<OpLimbStorage>(stats.limbBytes)))
+			return reserve.limb();
 		next->nextBlock = limbStorage;
 		next->baseIndex = limbStorage->baseIndex + ARRAY_COUNT(limbStorage->storage);
 		limbStorage->prevBlock = next;
@@ -361,6 +453,96 @@ PathOpsV0Lib::WindingData* OpContours::allocateWinding(size_t size) {
 	return (PathOpsV0Lib::WindingData*) result;
 }
 
+char* OpReserveStorage::callerData(size_t size) {
+	size_t alignSize = alignof(void*);
+	size_t alignPart = size % alignSize;
+	if (alignPart)
+		size += alignSize - alignPart;  // round up to next alignment
+	OP_ASSERT(size <= sizeof(callerStorage.storage));
+	if (callerStorage.used + size > sizeof(callerStorage.storage))
+		callerStorage.used = 0;
+	char* result = &callerStorage.storage[callerStorage.used];
+	callerStorage.used += size;
+	return result;
+}
+
+// the reserved contour is not in the contour list, so the engine never reads its curves
+OpContour* OpReserveStorage::contour() {
+	contourSlot.segments.clear();
+	return &contourSlot;
+}
+
+PathOpsV0Lib::CurveData* OpReserveStorage::curveData(size_t size) {
+	OP_ASSERT(size <= sizeof(curveDataStorage.storage));
+	if (curveDataStorage.used + size > sizeof(curveDataStorage.storage))
+		curveDataStorage.used = 0;
+	return curveDataStorage.curveData(size);
+}
+
+OpEdge* OpReserveStorage::edge() {
+	OpEdge& result = edges[edgeIndex];
+	edgeIndex = (edgeIndex + 1) % ARRAY_COUNT(edges);
+	result.~OpEdge();
+	new (&result) OpEdge();  // callers construct over a default edge, as in edge storage
+	return &result;
+}
+
+OpLimb* OpReserveStorage::limb() {
+	OpLimb& result = limbs[limbIndex];
+	limbIndex = (limbIndex + 1) % ARRAY_COUNT(limbs);
+	result = OpLimb();
+	return &result;
+}
+
+void OpReserveStorage::reset() {
+	callerStorage.used = 0;
+	curveDataStorage.used = 0;
+	contourSlot.segments.clear();
+	edgeIndex = 0;
+	sectIndex = 0;
+	limbIndex = 0;
+}
+
+OpIntersection* OpReserveStorage::sect() {
+	OpIntersection& result = sects[sectIndex];
+	sectIndex = (sectIndex + 1) % ARRAY_COUNT(sects);
+	result = OpIntersection();
+	return &result;
+}
+
+// moves thread blocks behind the first block of the chain, which may still have room
+template <typename T>
+static void AdoptChain(T*& chain, T* blocks) {
+	if (!blocks)
+		return;
+	T* last = blocks;
+	while (last->next)
+		last = last->next;
+	if (!chain) {
+		chain = blocks;
+		return;
+	}
+	last->next = chain->next;
+	chain->next = blocks;
+}
+
+void OpContours::adoptStorage(OpThreadStorage& storage) {
+	AdoptChain(ccStorage, storage.ccStorage);
+	AdoptChain(curveDataStorage, storage.curveDataStorage);
+	AdoptChain(callerStorage, storage.callerStorage);
+	storage = OpThreadStorage();
+}
+
+OpCurveScratch::OpCurveScratch(OpContours* c)
+	: contours(c)
+	, block(c->curveData())
+	, used(block ? block->used : 0) {
+}
+
+OpCurveScratch::~OpCurveScratch() {
+	contours->rewind(contours->curveData(), block, used);
+}
+
 // build list of linked edges
 // if they are closed, done
 // if not, match up remainder
@@ -389,6 +571,74 @@ bool OpContours::containsFiller(OpPoint start, OpPoint end) const {
 	return fillerStorage->contains(start, end);
 }
 
+// a closed loop of segments within one contour; a contour holds every loop of its path
+struct OpDisjointLoop {
+	OpContour* contour;
+	size_t begin;  // first segment in contour
+	size_t end;  // one past last segment
+	size_t group;  // loop in the same contour touching this one, directly or through others
+	OpPointBounds bounds;
+	bool touchesOther;  // bounds touch a loop in another contour
+};
+
+// a group of loops, all in one contour, whose bounds touch no other contour's loops is outside 
+// every other contour, so the other windings are zero everywhere it covers. If keep discards its
+// edges when its own winding is the sum on one side and zero on the other, the group changes
+// nothing: discard it. A new loop starts at a segment that does not start where the previous
+// segment ends; a loop broken in two pieces is one group, since the pieces touch
+void OpContours::discardDisjoint() {
+	std::vector<OpDisjointLoop> loops;
+	for (auto contour : contours) {
+		std::vector<OpSegment>& segments = contour->segments;
+		for (size_t index = 0; index < segments.size(); ++index) {
+			if (!index || segments[index].c.firstPt() != segments[index - 1].c.lastPt())
+				loops.push_back({ contour, index, index, loops.size(), OpPointBounds(), false });
+			loops.back().end = index + 1;
+			loops.back().bounds.add(segments[index].ptBounds);
+		}
+	}
+	auto findGroup = [&loops](size_t index) {
+		while (loops[index].group != index)
+			index = loops[index].group = loops[loops[index].group].group;
+		return index;
+	};
+	std::vector<size_t> byLeft(loops.size());
+	for (size_t index = 0; index < loops.size(); ++index)
+		byLeft[index] = index;
+	std::sort(byLeft.begin(), byLeft.end(), [&loops](size_t a, size_t b) {
+		return loops[a].bounds.left < loops[b].bounds.left;
+	});
+	for (size_t index = 0; index < byLeft.size(); ++index) {
+		OpDisjointLoop& loop = loops[byLeft[index]];
+		OpRect outset = loop.bounds.outset(aliases.threshold);
+		for (size_t next = index + 1; next < byLeft.size() 
+				&& loops[byLeft[next]].bounds.left <= outset.right; ++next) {
+			OpDisjointLoop& other = loops[byLeft[next]];
+			if (!outset.intersects(other.bounds))
+				continue;
+			if (loop.contour != other.contour)
+				loop.touchesOther = other.touchesOther = true;
+			else
+				loops[findGroup(byLeft[index])].group = findGroup(byLeft[next]);
+		}
+	}
+	for (size_t index = 0; index < loops.size(); ++index) {
+		if (loops[index].touchesOther)
+			loops[findGroup(index)].touchesOther = true;
+	}
+	for (size_t index = loops.size(); index-- > 0; ) {  // erase last loops first
+		OpDisjointLoop& loop = loops[index];
+		if (loops[findGroup(index)].touchesOther)
+			continue;
+		// segments copied the winding when added; the contour's may point to changed caller data
+		std::vector<OpSegment>& segments = loop.contour->segments;
+		PathOpsV0Lib::Winding winding = segments[loop.begin].winding.w;
+		if (PathOpsV0Lib::WindKeep::Discard 
+				== loop.contour->callBacks.windingKeepFuncPtr(winding, winding))
+			segments.erase(segments.begin() + loop.begin, segments.begin() + loop.end);
+	}
+}
+
 void OpContours::disableSmallSegments() {
 	SegmentIterator segIterator(this);
 	while (OpSegment* seg = segIterator.next()) {
@@ -418,10 +668,102 @@ OpLimb& OpContours::nthLimb(int index) {
 	return limbCurrent->storage[index];
 }
 
+// moves enough blocks to the spare list to hold bytes of curve data without further allocation
+void OpContours::reserveCurveData(size_t bytes) {
+	size_t available = curveDataStorage ? 
+			sizeof(curveDataStorage->storage) - curveDataStorage->used : 0;
+	for (CurveDataStorage* spare = curveDataSpare; spare; spare = spare->next)
+		available += sizeof(spare->storage);
+	while (available < bytes && PathOpsV0Lib::ContextError::memory != error) {
+		CurveDataStorage* next = allocateBlock<CurveDataStorage>(stats.curveDataBytes);
+		if (!next)
+			return;
+		next->next = curveDataSpare;
+		curveDataSpare = next;
+		available += sizeof(next->storage);
+	}
+}
+
+// Clears all contours, curves, intersections and edges. Curve, context, and error callbacks
+// are kept, and storage blocks are moved to spare lists so the next Resolve can reuse them.
+void OpContours::reset() {
+	reuse(ccStorage);
+	reuse(fillerStorage);
+	while (CurveDataStorage* block = curveDataStorage) {
+		curveDataStorage = block->next;
+		block->used = 0;
+		block->next = curveDataSpare;
+		curveDataSpare = block;
+	}
+	while (OpContourStorage* block = contourStorage) {
+		contourStorage = block->next;
+		for (int index = 0; index < block->used; ++index)
+			block->storage[index].segments.clear();  // keep vector capacity for next contour
+		block->used = 0;
+		block->next = contourSpare;
+		contourSpare = block;
+	}
+	while (OpSectStorage* block = sectStorage) {
+		sectStorage = block->next;
+		for (int index = 0; index < block->used; ++index)
+			block->storage[index] = OpIntersection();
+		block->used = 0;
+		block->next = sectSpare;
+		sectSpare = block;
+	}
+	if (limbStorage)
+		resetLimbs();
+	while (CallerDataStorage* block = callerStorage) {
+		callerStorage = block->next;
+		block->used = 0;
+		block->next = callerSpare;
+		callerSpare = block;
+	}
+	reserve.reset();
+	aliases.aliases.clear();
+	aliases.maps.clear();
+	aliases.threshold = OpVector();
+	if (memoryBudget && memoryUsed > memoryBudget)
+		releaseSpares();
+	memoryPeak = memoryUsed;
+	maxBounds = OpPointBounds();
+	callerOutput = nullptr;
+	outputCurves.clear();
+	error = PathOpsV0Lib::ContextError::none;
+	uniqueID = 0;
+	outputOne = false;
+#if OP_DEBUG_VALIDATE
+	debugValidateEdgeIndex = 0;
+	debugValidateJoinerIndex = 0;
+#endif
+#if OP_DEBUG
+	debugCurveCurve = nullptr;
+	debugJoiner = nullptr;
+	debugTree = nullptr;
+	debugOutputID = 0;
+	debugErrorID = 0;
+	debugOppErrorID = 0;
+	debugInPathOps = false;
+	debugInClearEdges = false;
+	debugCheckLastEdge = false;
+	debugFailOnEqualCepts = false;
+	OP_DEBUG_DUMP_CODE(debugCurveCurveCall = 0);
+#endif
+}
+
+// keeps the most recent block; older blocks are moved to the spare list
 void OpContours::resetLimbs() {
-	if (!limbStorage)
-		limbStorage = new OpLimbStorage;
+	if (!limbStorage && !(limbStorage = allocateBlock<OpLimbStorage>(stats.limbBytes)))
+		return;  // limbs come from the reserve
+	while (OpLimbStorage* block = limbStorage->nextBlock) {
+		limbStorage->nextBlock = block->nextBlock;
+		block->nextBlock = nullptr;
+		block->reset();
+		block->nextBlock = limbSpare;
+		limbSpare = block;
+	}
 	limbStorage->reset();
+	limbCurrent = nullptr;
 }
 
 // If successive runs of the same input are flaky, check to see if identical ids are generated.
@@ -438,48 +780,92 @@ void OpContours::opsInit() {
 #endif
 }
 
+// returns true if resolve must stop: storage was exhausted, or caller cancelled
+bool OpContours::aborted() {
+	auto lock = lockBlocks();
+	if (contextCallBacks.cancelFuncPtr && PathOpsV0Lib::ContextError::none == error
+			&& contextCallBacks.cancelFuncPtr((PathOpsV0Lib::Context*) this))
+		setError(PathOpsV0Lib::ContextError::timeout  OP_DEBUG_PARAMS(0));
+	return PathOpsV0Lib::ContextError::memory == error
+			|| PathOpsV0Lib::ContextError::timeout == error;
+}
+
 bool OpContours::pathOps() {
+	using PathOpsV0Lib::ResolvePhase;
+	if (aborted())
+		return false;
+	startPhase(ResolvePhase::discardDisjoint);
+	discardDisjoint();  // contours that can't change output if no other contour overlaps them
+	startPhase(ResolvePhase::findCoincidences);
 	OpSegments::FindCoincidences(this);
+	if (aborted())
+		return false;
 	debugValidateIntersections();
+	startPhase(ResolvePhase::sortSegments);
 	OpSegments sortedSegments(*this);
 	debugValidateIntersections();
 	if (!sortedSegments.inX.size()) {
 		contextCallBacks.emptyCallerPathFuncPtr(callerOutput);
 		OP_DEBUG_SUCCESS(*this, true);
 	}
+	startPhase(ResolvePhase::findIntersections);
 	if (FoundIntersections::fail == sortedSegments.findIntersections())
 		return setError(PathOpsV0Lib::ContextError::intersection  
 				OP_DEBUG_PARAMS(sortedSegments.debugFailSegID));
+	if (aborted())  // caller's allocator is exhausted, or caller cancelled
+		return false;
 	debugValidateIntersections();
+	startPhase(ResolvePhase::addDisjoint);
 	if (errorHandler.errorDispatchFuncPtr && !errorHandler.errorDispatchFuncPtr(
 			PathOpsV0Lib::ContextError::missing, (PathOpsV0Lib::Context*) this, nullptr)) {
 		addDisjointIntersections();
 	}
+	startPhase(ResolvePhase::disableSmall);
 	disableSmallSegments();  // moved points may allow disabling some segments
 	if (empty()) {
 		contextCallBacks.emptyCallerPathFuncPtr(callerOutput);  // no existing tests exercises
 		OP_DEBUG_SUCCESS(*this, true);
 	}
+	startPhase(ResolvePhase::sortIntersections);
 	sortIntersections();
+	startPhase(ResolvePhase::fixCurveCurveSects);
 	fixCCSects();  // curve-curve intersections may have enough error to put sect list out of order
+	startPhase(ResolvePhase::sortIntersections);
 	sortIntersections();
+	startPhase(ResolvePhase::findMissingEnds);
 	findMissingEnds();  // moved pts may require looking in aliases for an end match
+	startPhase(ResolvePhase::betweenIntersections);
 	betweenIntersections();  // fill in intersections in coin runs that are missing in other coins
+	if (aborted())
+		return false;
+	startPhase(ResolvePhase::sortIntersections);
 	sortIntersections();
+	startPhase(ResolvePhase::makeEdges);
 	makeEdges();
+	startPhase(ResolvePhase::makeCoins);
 	makeCoins();
+	startPhase(ResolvePhase::sortIntersections);
 	sortIntersections();
+	startPhase(ResolvePhase::transferCoins);
 	transferCoins();
+	startPhase(ResolvePhase::makePals);
 	makePals();  // edges too close to each other to sort or precisely intersect
+	if (aborted())
+		return false;
 
 	// made edges may include lines that are coincident with other edges. Undetected for now...
 //    windCoincidences();  // for segment h/v lines, compute their winding considering coincidence
+	startPhase(ResolvePhase::setWindings);
 	OpWinder windingEdges(*this);
 	FoundWindings foundWindings = windingEdges.setWindings(this);  // walk edges, compute windings
+	if (aborted())
+		return false;
 	if (FoundWindings::fail == foundWindings)
 		OP_DEBUG_FAIL(*this, false);  // no existing tests exercises
 	OP_DEBUG_DUMP_CODE(debugContext = "apply");
+	startPhase(ResolvePhase::apply);
 	apply();  // suppress edges which don't meet op criteria
+	startPhase(ResolvePhase::assemble);
 	if (!assemble())
 		OP_DEBUG_FAIL(*this, false);
 	// !!! missing final step to reverse order of contours as winding rule requires
@@ -494,7 +880,7 @@ bool OpContours::pathOps() {
 void OpContours::release(OpEdgeStorage*& edgeStorage) {
 	while (edgeStorage) {
 		OpEdgeStorage* next = edgeStorage->next;
-		delete edgeStorage;
+		freeBlock(edgeStorage);
 		edgeStorage = next;
 	}
 }
@@ -509,20 +895,34 @@ OpPoint OpContours::remapPts(OpPoint oldAlias, OpPoint newAlias) {
 	return newAlias;
 }
 
-// seems too complicated to reuse multiple edge storage blocks, so delete all but first
-#if 0
-void OpContours::reuse(OpEdgeStorage* edgeStorage) {
-	if (!edgeStorage)
-		return;
-	OpEdgeStorage* next = edgeStorage->next;
-	while (next) {
-		OpEdgeStorage* following = next->next;
-		delete next;
-		next = following;
+// moves edge storage blocks to the spare list; pointers to edges in the blocks become invalid
+void OpContours::reuse(OpEdgeStorage*& edgeStorage) {
+	while (OpEdgeStorage* block = edgeStorage) {
+		edgeStorage = block->next;
+		block->reuse();
+		block->next = edgeSpare;
+		edgeSpare = block;
+	}
+}
+
+// moves blocks added to the chain since block was first to the spare list, and restores block's
+// used bytes; curve data allocated after the mark becomes invalid
+void OpContours::rewind(CurveDataStorage*& chain, CurveDataStorage* block, size_t used) {
+	if (chain != block) {
+		auto lock = lockBlocks();
+		while (chain != block) {
+			CurveDataStorage* next = chain;
+			chain = next->next;
+			next->used = 0;
+			next->next = curveDataSpare;
+			curveDataSpare = next;
+		}
+	}
+	if (block) {
+		OP_ASSERT(block->used >= used);
+		block->used = used;
 	}
-	edgeStorage->reuse();
 }
-#endif
 
 bool OpContours::setError(PathOpsV0Lib::ContextError e  OP_DEBUG_PARAMS(int eID, int oID)) {
 	if (PathOpsV0Lib::ContextError::none != error)
@@ -530,6 +930,7 @@ bool OpContours::setError(PathOpsV0Lib::ContextError e  OP_DEBUG_PARAMS(int eID,
 #if OP_DEBUG
 	OP_ASSERT(debugData.limitContours <= 0);  // break when debugging limited number of contours
 	if (PathOpsV0Lib::ContextError::finite != e 
+			&& PathOpsV0Lib::ContextError::timeout != e
 			&& PathOpsV0Lib::ContextError::toVertical != e)
 		OpDebugOut("fatal error in " + debugData.testname + "\n");
 #endif
@@ -565,6 +966,18 @@ void OpContours::sortIntersections() {
 	}
 }
 
+// reports the end of the current phase, if any, and the start of the next, if any
+void OpContours::startPhase(PathOpsV0Lib::ResolvePhase next) {
+	PathOpsV0Lib::PhaseDispatch dispatch = phaseHandler.phaseDispatchFuncPtr;
+	if (!dispatch)
+		return;
+	if (PathOpsV0Lib::ResolvePhase::none != phase)
+		dispatch(phase, false, (PathOpsV0Lib::Context*) this);
+	phase = next;
+	if (PathOpsV0Lib::ResolvePhase::none != next)
+		dispatch(next, true, (PathOpsV0Lib::Context*) this);
+}
+
 bool OpContours::debugFail() const {
 #if OP_DEBUG
 	return OpDebugExpect::unknown == debugExpect || OpDebugExpect::fail == debugExpect;
@@ -4,6 +4,8 @@
 
 #include "OpJoiner.h"
 #include "OpTightBounds.h"
+#include <atomic>
+#include <mutex>
 #if TEST_RASTER
 #include "OpDebugRaster.h"
 #endif
@@ -21,7 +23,8 @@ struct OpInPath;
 struct CallerDataStorage {
 	CallerDataStorage()
 		: next(nullptr)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 		OP_DEBUG_CODE(memset(storage, 0, sizeof(storage)));
 	}
 
@@ -34,6 +37,7 @@ struct CallerDataStorage {
 	CallerDataStorage* next;
 	size_t used;
 	char storage[2048];	// !!! size is arbitrary guess -- should measure and do better
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 struct OpContour {
@@ -133,6 +137,7 @@ struct OpContour {
 	std::vector<OpSegment> segments;
 	PathOpsV0Lib::Winding winding;
 	PathOpsV0Lib::WindingCallBacks callBacks;
+	OpBuiltInWinding builtIn;  // set with callBacks
 	OP_DEBUG_CODE(PathOpsV0Lib::DebugContourCallBacks debugCallBacks);
 	OP_DEBUG_CODE(PathOpsV0Lib::DebugCallerData debugCaller);  // note: must use std::memcpy before reading
 #if TEST_RASTER
@@ -144,7 +149,8 @@ struct OpContour {
 struct OpContourStorage {
 	OpContourStorage()
 		: next(nullptr)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 	}
 
 #if OP_DEBUG_DUMP
@@ -158,6 +164,7 @@ struct OpContourStorage {
 	OpContourStorage* next;
 	OpContour storage[2];
 	int used;
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 struct OpContourIter {
@@ -259,14 +266,71 @@ struct OpPtAliases {
 	OpVector threshold;
 };
 
+// chains filled by one thread while curve pairs are intersected in parallel; when the threads
+// finish, the chains are moved to the context so the blocks are reused or freed with the rest
+struct OpThreadStorage {
+	OpThreadStorage()
+		: ccStorage(nullptr)
+		, curveDataStorage(nullptr)
+		, callerStorage(nullptr) {
+	}
+
+	OpEdgeStorage* ccStorage;
+	CurveDataStorage* curveDataStorage;
+	CallerDataStorage* callerStorage;
+};
+
+// Allocated with the context. After a storage block can't be allocated, allocations are served
+// from here so the engine can unwind to its next abort check without allocating more. Slots are
+// reused in turn; what they hold is only read by the resolve that failed.
+struct OpReserveStorage {
+	OpReserveStorage()
+		: edgeIndex(0)
+		, sectIndex(0)
+		, limbIndex(0) {
+	}
+
+	char* callerData(size_t );
+	OpContour* contour();
+	PathOpsV0Lib::CurveData* curveData(size_t );
+	OpEdge* edge();
+	OpLimb* limb();
+	void reset();
+	OpIntersection* sect();
+
+	CallerDataStorage callerStorage;
+	CurveDataStorage curveDataStorage;
+	OpContour contourSlot;
+	OpEdge edges[8];
+	OpIntersection sects[8];
+	OpLimb limbs[8];
+	int edgeIndex;
+	int sectIndex;
+	int limbIndex;
+};
+
+// Marks the top of the calling thread's curve data chain. When the mark goes out of scope, curve
+// data allocated since the mark is freed, so curves built in its scope must not outlive it.
+// Used for rotated and subdivided curves that are only needed while the caller runs.
+struct OpCurveScratch {
+	OpCurveScratch(OpContours* );
+	~OpCurveScratch();
+
+	OpContours* contours;
+	CurveDataStorage* block;  // first block in chain when marked
+	size_t used;  // bytes used in block when marked
+};
+
 struct OpContours {
 	OpContours();
 	~OpContours();
 
+	bool aborted();
 	bool addAlias(OpPoint pt, OpPoint alias);
 //    OpEdge* addFiller(OpEdge* edge, OpEdge* lastEdge);
 	OpEdge* addFiller(const OpPtT& start, const OpPtT& end);
 	void addToBounds(const OpCurve& );
+	template <typename T> T* allocateBlock(size_t& chainBytes);
 	char* allocateCallerData(size_t );
 	OpContour* allocateContour();
 	PathOpsV0Lib::CurveData* allocateCurveData(size_t );
@@ -274,6 +338,7 @@ struct OpContours {
 	OpIntersection* allocateIntersection();
 	OpLimb* allocateLimb();
 	PathOpsV0Lib::WindingData* allocateWinding(size_t );
+	void adoptStorage(OpThreadStorage& );
 
 	void addDisjointIntersections() {
 		for (auto contour : contours) {
@@ -295,6 +360,12 @@ struct OpContours {
 		}
 	}
 
+	// none if type is not registered, or does not match a curve in curves/
+	BuiltInCurve builtIn(PathOpsV0Lib::CurveType type) const {
+		size_t index = (size_t) type - 1;  // type zero wraps to out of range
+		return index < builtInCurves.size() ? builtInCurves[index] : BuiltInCurve::none;
+	}
+
 	PathOpsV0Lib::CurveCallBacks& callBack(PathOpsV0Lib::CurveType type) {
 		return callBacks[(int) type - 1];
 	}
@@ -302,6 +373,7 @@ struct OpContours {
 	bool containsFiller(OpPoint start, OpPoint end) const;
 //    WindingData* copySect(const OpWinding& );  // !!! add a separate OpWindingStorage for temporary blocks?
 	void disableSmallSegments();
+	void discardDisjoint();
 
 	bool empty() {
 		for (auto contour : contours) {
@@ -319,6 +391,8 @@ struct OpContours {
 		return aliases.find(pt);
 	}
 
+	template <typename T> void freeBlock(T* );
+
 	void fixCCSects() {
 	   for (auto contour : contours) {
 			contour->fixCCSects();
@@ -361,6 +435,22 @@ struct OpContours {
 		}
 	}
 
+	// curve-curve edges go to the calling thread's chain if it has one
+	OpEdgeStorage*& ccEdges() {
+		return threadStorage ? threadStorage->ccStorage : ccStorage;
+	}
+
+	// curve data goes to the calling thread's chain if it has one
+	CurveDataStorage*& curveData() {
+		return threadStorage ? threadStorage->curveDataStorage : curveDataStorage;
+	}
+
+	// blocks and spares are shared; threads intersecting curve pairs take turns
+	std::unique_lock<std::mutex> lockBlocks() {
+		return threadStorage ? std::unique_lock<std::mutex>(blockMutex) 
+				: std::unique_lock<std::mutex>();
+	}
+
 	int nextID() { 
 		return ++uniqueID; 
 	}
@@ -375,13 +465,18 @@ struct OpContours {
 	void opsInit();
 	bool pathOps();
 	void release(OpEdgeStorage*& );
+	void releaseSpares();
 	OpPoint remapPts(OpPoint oldAlias, OpPoint newAlias);
+	void reserveCurveData(size_t bytes);
+	void reset();
 	void resetLimbs();
-//	void reuse(OpEdgeStorage* );
+	void reuse(OpEdgeStorage*& );
+	void rewind(CurveDataStorage*& chain, CurveDataStorage* block, size_t used);
 
 	bool setError(PathOpsV0Lib::ContextError  OP_DEBUG_PARAMS(int id, int id2 = 0));
 	void setThreshold();
 	void sortIntersections();
+	void startPhase(PathOpsV0Lib::ResolvePhase );
 
 	OpVector threshold() const {
 		return aliases.threshold;
@@ -423,10 +518,14 @@ struct OpContours {
 #endif
 
 	OpPtAliases aliases;
+	PathOpsV0Lib::AllocatorCallBacks allocator;
 	std::vector<PathOpsV0Lib::CurveCallBacks> callBacks;
+	std::vector<BuiltInCurve> builtInCurves;  // one per callbacks entry
 	PathOpsV0Lib::ContextCallBacks contextCallBacks;
 	PathOpsV0Lib::PathOutput callerOutput;
+	std::vector<PathOpsV0Lib::Curve> outputCurves;  // reused by contour output callback
 	PathOpsV0Lib::ErrorHandler errorHandler;
+	PathOpsV0Lib::PhaseHandler phaseHandler;
 	// these are pointers instead of inline values because the storage with empty slots is first
 	OpEdgeStorage* ccStorage;
 	CurveDataStorage* curveDataStorage;
@@ -437,9 +536,25 @@ struct OpContours {
 	OpLimbStorage* limbStorage;
 	OpLimbStorage* limbCurrent;
 	CallerDataStorage* callerStorage;
+	// blocks kept by reset for reuse; allocators take from these before calling new
+	OpEdgeStorage* edgeSpare;
+	CurveDataStorage* curveDataSpare;
+	OpContourStorage* contourSpare;
+	OpSectStorage* sectSpare;
+	OpLimbStorage* limbSpare;
+	CallerDataStorage* callerSpare;
+	size_t memoryBudget;  // most bytes in storage blocks; zero if unlimited
+	size_t memoryUsed;  // bytes in storage blocks, including spares
+	size_t memoryPeak;  // most bytes used since created or reset
+	OpReserveStorage reserve;  // used once a storage block can't be allocated
+	std::mutex blockMutex;  // guards spares and block accounting while threads run
+	static thread_local OpThreadStorage* threadStorage;  // set while thread intersects curves
+	unsigned threadCount;  // most threads used to intersect curve pairs
+	PathOpsV0Lib::ContextStats stats;
 	OpPointBounds maxBounds;
 	PathOpsV0Lib::ContextError error;
-	int uniqueID;  // used for object id, unsectable id, coincidence id
+	PathOpsV0Lib::ResolvePhase phase;
+	std::atomic<int> uniqueID;  // used for object id, unsectable id, coincidence id
 	bool outputOne;
 #if OP_DEBUG_VALIDATE
 	int debugValidateEdgeIndex;
@@ -469,6 +584,7 @@ struct OpContours {
 	bool debugFailOnEqualCepts;
 #endif
 #if OP_DEBUG_DUMP
+	int debugCurveCurveCall;  // which call to curve-curve was made
 	bool debugDumpInit;   // if true, created by dump init
 #endif
 };
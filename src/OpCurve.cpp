@@ -1,11 +1,38 @@
 // (c) 2023, Cary Clark cclark2@gmail.com
 #include "OpCurve.h"
 #include "OpContour.h"
+#include "OpCurveSet.h"
 #include "OpTightBounds.h"
 #if OP_DEBUG
 #include "OpDebugRaster.h"
 #endif
 
+// Calls fn with the callbacks for the curve's type. A built-in curve passes its compile-time
+// set, so fn's calls through it are direct and can be inlined; other types pass the callbacks
+// registered with the context. fn takes const auto& so it is compiled once for each.
+template <typename Fn>
+auto OpCurve::dispatch(Fn fn) const {
+	switch (builtIn) {
+		case BuiltInCurve::line: return fn(OpLineFuncs());
+		case BuiltInCurve::quad: return fn(OpQuadFuncs());
+		case BuiltInCurve::conic: return fn(OpConicFuncs());
+		case BuiltInCurve::cubic: return fn(OpCubicFuncs());
+		default: return fn(contours->callBack(c.type));
+	}
+}
+
+BuiltInCurve OpCurve::FindBuiltIn(const PathOpsV0Lib::CurveCallBacks& callBacks) {
+	if (OpLineFuncs::Matches(callBacks))
+		return BuiltInCurve::line;
+	if (OpQuadFuncs::Matches(callBacks))
+		return BuiltInCurve::quad;
+	if (OpConicFuncs::Matches(callBacks))
+		return BuiltInCurve::conic;
+	if (OpCubicFuncs::Matches(callBacks))
+		return BuiltInCurve::cubic;
+	return BuiltInCurve::none;
+}
+
 OpRoots OpCurve::axisRayHit(Axis axis, float axisIntercept, float start, float end) const {
 	OpRoots roots = axisRawHit(axis, axisIntercept, MatchEnds::none);
 	roots.keepValidTs(start, end);
@@ -21,8 +48,9 @@ float OpCurve::center(Axis axis, float intercept) const {
 
 // cut range minimum should be double the distance between ptT pt and opp pt
 CutRangeT OpCurve::cutRange(const OpPtT& ptT, OpPoint oppPt, float loEnd, float hiEnd) const {
-	PathOpsV0Lib::CurveConst cutFun = contours->callBack(c.type).cutFuncPtr;
-	float tStep = cutFun ? (*cutFun)(c) : 16.f;
+	float tStep = dispatch([this](const auto& callBacks) {
+		return OpHasCallBack(callBacks.cutFuncPtr) ? (*callBacks.cutFuncPtr)(c) : 16.f;
+	});
 	float cutDt = OpEpsilon * tStep;
 	OpVector threshold = contours->threshold();
 	float minDistanceSq = threshold.lengthSquared() * tStep;
@@ -42,10 +70,11 @@ CutRangeT OpCurve::cutRange(const OpPtT& ptT, OpPoint oppPt, float loEnd, float
 }
 
 float OpCurve::interceptLimit() const {
-	PathOpsV0Lib::CurveConst limFuncPtr = contours->callBack(c.type).interceptFuncPtr;
-	if (!limFuncPtr)
-		return 1.f / 256.f;
-	return (*limFuncPtr)(c);
+	return dispatch([this](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.interceptFuncPtr))
+			return 1.f / 256.f;
+		return (*callBacks.interceptFuncPtr)(c);
+	});
 }
 
 OpRootPts OpCurve::lineIntersect(const LinePts& line) const {
@@ -134,10 +163,11 @@ NormalDirection OpCurve::normalDirection(Axis axis, float t) const {
 }
 
 float OpCurve::normalLimit() const {
-	PathOpsV0Lib::CurveConst limFuncPtr = contours->callBack(c.type).normalLimitFuncPtr;
-	if (!limFuncPtr)
-		return 0.008f; // 0.004  fails on testQuads19022897 edge 151 NxR:-0.00746
-	return (*limFuncPtr)(c);
+	return dispatch([this](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.normalLimitFuncPtr))
+			return 0.008f; // 0.004  fails on testQuads19022897 edge 151 NxR:-0.00746
+		return (*callBacks.normalLimitFuncPtr)(c);
+	});
 }
 
 bool OpCurve::normalize() {
@@ -184,6 +214,7 @@ OpRoots OpCurve::rawIntersect(const LinePts& linePt, MatchEnds common) const {
 		return axisRawHit(Axis::vertical, linePt.pts[0].x, common);
 	if (linePt.pts[0].y == linePt.pts[1].y)
 		return axisRawHit(Axis::horizontal, linePt.pts[0].y, common);
+	OpCurveScratch scratch(contours);  // rotated curve is freed on return
 	OpCurve rotated = toVertical(linePt, common);
 	if (!rotated.isFinite()) {
 		contours->setError(PathOpsV0Lib::ContextError::toVertical  OP_DEBUG_PARAMS(0));
@@ -198,6 +229,57 @@ OpRoots OpCurve::rawIntersect(const LinePts& linePt, MatchEnds common) const {
 }
 
 // !!! this should return OpPoint as well as t so caller doesn't have to recompute
+// same result as ray intersect for a line with no geometry callbacks, without allocating a
+// rotated curve
+OpRoots OpCurve::lineRayIntersect(const LinePts& line, MatchEnds common) const {
+	OpPoint start = firstPt();
+	OpPoint end = lastPt();
+	float rawRoot;
+	if (line.pts[0].x == line.pts[1].x)
+		rawRoot = (line.pts[0].x - start.x) / (end.x - start.x);
+	else if (line.pts[0].y == line.pts[1].y)
+		rawRoot = (line.pts[0].y - start.y) / (end.y - start.y);
+	else {
+		LinePts rotated = lineToVertical(line, common);
+		if (!rotated.pts[0].isFinite() || !rotated.pts[1].isFinite()) {
+			contours->setError(PathOpsV0Lib::ContextError::toVertical  OP_DEBUG_PARAMS(0));
+			return OpRoots();
+		}
+		float startX = rotated.pts[0].x;
+		float endX = rotated.pts[1].x;
+		if (std::max(startX, endX) < 0 || std::min(startX, endX) > 0)
+			return OpRoots();
+		rawRoot = (0 - startX) / (endX - startX);
+	}
+	OpRoots roots(rawRoot);
+	roots.keepValidTs();
+	if (!roots.count())
+		return roots;
+	OpVector lineV = line.pts[1] - line.pts[0];
+	XyChoice xy = fabsf(lineV.dx) >= fabsf(lineV.dy) ? XyChoice::inX : XyChoice::inY;
+	float t = roots.roots[0];
+	OpPoint hit = 0 == t ? start : 1 == t ? end : (1 - t) * start + t * end;
+	if (!OpMath::InUnsorted(line.pts[0].choice(xy), hit.choice(xy), line.pts[1].choice(xy),
+			contours->threshold().choice(xy)))
+		return OpRoots();
+	return roots;
+}
+
+// end points of to vertical for a line with no rotate callback, without allocating curve data
+LinePts OpCurve::lineToVertical(const LinePts& line, MatchEnds match) const {
+	OpVector scale = line.pts[1] - line.pts[0];
+	auto rotatePt = [line, scale](OpPoint pt) {
+		OpVector v = pt - line.pts[0];
+		return OpPoint(scale.cross(v), scale.dot(v));
+	};
+	LinePts rotated { rotatePt(firstPt()), rotatePt(lastPt()) };
+	if (MatchEnds::start & match)
+		rotated.pts[0].x = 0;
+	if (MatchEnds::end & match)
+		rotated.pts[1].x = 0;
+	return rotated;
+}
+
 OpRoots OpCurve::rayIntersect(const LinePts& line, MatchEnds common) const {
 	OpRoots rawRoots = rawIntersect(line, common);
 	rawRoots.keepValidTs();
@@ -206,7 +288,7 @@ OpRoots OpCurve::rayIntersect(const LinePts& line, MatchEnds common) const {
 	OpRoots realRoots;
 	OpVector lineV = line.pts[1] - line.pts[0];
 	XyChoice xy = fabsf(lineV.dx) >= fabsf(lineV.dy) ? XyChoice::inX : XyChoice::inY;
-	for (float rawRoot : rawRoots.roots) {
+	for (float rawRoot : rawRoots) {
 		OpPoint hit = ptAtT(rawRoot);
 		// in thread_circles36945 : conic mid touches opposite conic only at end point
 		// without this fix, in one direction, intersection misses by 2 epsilon, in the other 1 eps
@@ -257,10 +339,10 @@ float OpCurve::tZeroX(float t1, float t2) const {
 #include "OpContour.h"
 
 void OpCurve::pinCtrl() {
-	PathOpsV0Lib::CurvePinCtrl funcPtr = contours->callBack(c.type).curvePinCtrlFuncPtr;
-	if (funcPtr)
-		(*funcPtr)(c);
-	return;
+	dispatch([this](const auto& callBacks) {
+		if (OpHasCallBack(callBacks.curvePinCtrlFuncPtr))
+			(*callBacks.curvePinCtrlFuncPtr)(c);
+	});
 }
 
 bool OpCurve::isFinite() const {
@@ -268,8 +350,11 @@ bool OpCurve::isFinite() const {
 		return false;
 	if (!c.data->end.isFinite())
 		return false;
-	PathOpsV0Lib::CurveIsFinite funcPtr = contours->callBack(c.type).curveIsFiniteFuncPtr;
-	return funcPtr ? (*funcPtr)(c) : true;
+	return dispatch([this](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.curveIsFiniteFuncPtr))
+			return true;
+		return (*callBacks.curveIsFiniteFuncPtr)(c);
+	});
 }
 
 // this can fail (if rotated pts are not finite); can happen when input is finite
@@ -289,15 +374,17 @@ OpCurve OpCurve::toVertical(const LinePts& line, MatchEnds match) const {
 	rotated.c.data->end = rotatePt(c.data->end);
 	if (MatchEnds::end & match)
 		rotated.c.data->end.x = 0;
-	PathOpsV0Lib::Rotate funcPtr = contours->callBack(c.type).rotateFuncPtr;
-	if (funcPtr)
-		(*funcPtr)(c, line.pts[0], scale, rotated.c);
+	dispatch([this, &line, scale, &rotated](const auto& callBacks) {
+		if (OpHasCallBack(callBacks.rotateFuncPtr))
+			(*callBacks.rotateFuncPtr)(c, line.pts[0], scale, rotated.c);
+	});
 	return rotated;
 }
 
 int OpCurve::pointCount() const {
-	PathOpsV0Lib::HullPtCount funcPtr = contours->callBack(c.type).ptCountFuncPtr;
-	return 2 + (funcPtr ? (*funcPtr)() : 0);
+	return dispatch([](const auto& callBacks) {
+		return 2 + (OpHasCallBack(callBacks.ptCountFuncPtr) ? (*callBacks.ptCountFuncPtr)() : 0);
+	});
 }
 
 OpPoint OpCurve::ptAtT(float t) const {
@@ -305,10 +392,11 @@ OpPoint OpCurve::ptAtT(float t) const {
 		return c.data->start;
 	if (1 == t)
 		return c.data->end;
-	PathOpsV0Lib::PtAtT funcPtr = contours->callBack(c.type).ptAtTFuncPtr;
-	if (!funcPtr)
-		return (1 - t) * c.data->start + t * c.data->end;
-	return (*funcPtr)(c, t);
+	return dispatch([this, t](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.ptAtTFuncPtr))
+			return (1 - t) * c.data->start + t * c.data->end;
+		return (*callBacks.ptAtTFuncPtr)(c, t);
+	});
 }
 
 OpCurve OpCurve::subDivide(OpPtT ptT1, OpPtT ptT2) const {
@@ -316,9 +404,10 @@ OpCurve OpCurve::subDivide(OpPtT ptT1, OpPtT ptT2) const {
 	OpCurve newResult(contours, newCurve);
     newResult.c.data->start = ptT1.pt;
     newResult.c.data->end = ptT2.pt;
-	PathOpsV0Lib::SubDivide funcPtr = contours->callBack(c.type).subDivideFuncPtr;
-	if (funcPtr)
-		(*funcPtr)(c, ptT1.t, ptT2.t, newResult.c);
+	dispatch([this, ptT1, ptT2, &newResult](const auto& callBacks) {
+		if (OpHasCallBack(callBacks.subDivideFuncPtr))
+			(*callBacks.subDivideFuncPtr)(c, ptT1.t, ptT2.t, newResult.c);
+	});
 	return newResult;
 }
 
@@ -329,17 +418,19 @@ OpVector OpCurve::normal(float t) const {
 }
 
 OpVector OpCurve::tangent(float t) const {
-	PathOpsV0Lib::CurveTangent funcPtr = contours->callBack(c.type).curveTangentFuncPtr;
-	if (!funcPtr)
-		return c.data->end - c.data->start;
-	return (*funcPtr)(c, t);
+	return dispatch([this, t](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.curveTangentFuncPtr))
+			return c.data->end - c.data->start;
+		return (*callBacks.curveTangentFuncPtr)(c, t);
+	});
 }
 
 OpPair OpCurve::xyAtT(OpPair t, XyChoice xy) const {
-	PathOpsV0Lib::XYAtT funcPtr = contours->callBack(c.type).xyAtTFuncPtr;
-	if (!funcPtr)
-		return (1 - t) * c.data->start.choice(xy) + t * c.data->end.choice(xy);
-	return (*funcPtr)(c, t, xy);
+	return dispatch([this, t, xy](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.xyAtTFuncPtr))
+			return (1 - t) * c.data->start.choice(xy) + t * c.data->end.choice(xy);
+		return (*callBacks.xyAtTFuncPtr)(c, t, xy);
+	});
 }
 
 OpPoint OpCurve::hullPt(int index) const {
@@ -348,15 +439,18 @@ OpPoint OpCurve::hullPt(int index) const {
 		return c.data->start;
 	if (pointCount() - 1 == index)
 		return c.data->end;
-	OP_ASSERT(contours->callBack(c.type).curveHullFuncPtr);
-	return contours->callBack(c.type).curveHullFuncPtr(c, index);
+	return dispatch([this, index](const auto& callBacks) {
+		OP_ASSERT(OpHasCallBack(callBacks.curveHullFuncPtr));
+		return (*callBacks.curveHullFuncPtr)(c, index);
+	});
 }
 
 void OpCurve::reverse() {
 	std::swap(c.data->start, c.data->end);
-	PathOpsV0Lib::CurveReverse funcPtr = contours->callBack(c.type).curveReverseFuncPtr;
-	if (funcPtr)
-		(*funcPtr)(c);
+	dispatch([this](const auto& callBacks) {
+		if (OpHasCallBack(callBacks.curveReverseFuncPtr))
+			(*callBacks.curveReverseFuncPtr)(c);
+	});
 }
 
 OpCurve::OpCurve(OpContours* cntrs, PathOpsV0Lib::Curve curve) {
@@ -366,8 +460,11 @@ OpCurve::OpCurve(OpContours* cntrs, PathOpsV0Lib::Curve curve) {
 	if (curve.data)
 		std::memcpy(c.data, curve.data, c.size);
 	c.type = curve.type;
-	PathOpsV0Lib::CurveIsLine funcPtr = contours->callBack(c.type).curveIsLineFuncPtr;
-	if (!funcPtr) {
+	builtIn = contours->builtIn(c.type);
+	bool hasIsLine = dispatch([](const auto& callBacks) {
+		return OpHasCallBack(callBacks.curveIsLineFuncPtr);
+	});
+	if (!hasIsLine) {
 		isLineSet = true;
 		isLineResult = true;
 	} else {
@@ -377,22 +474,26 @@ OpCurve::OpCurve(OpContours* cntrs, PathOpsV0Lib::Curve curve) {
 }
 
 OpRoots OpCurve::axisRawHit(Axis axis, float intercept, MatchEnds matchEnds) const {
-	PathOpsV0Lib::AxisT func = contours->callBack(c.type).axisTFuncPtr;
-	if (!func) {
-		const float* ptr = c.data->start.asPtr(axis);
-		return OpRoots((intercept - ptr[0]) / (ptr[2] - ptr[0]));
-	}
-	return (*func)(c, axis, intercept, matchEnds);
+	return dispatch([this, axis, intercept, matchEnds](const auto& callBacks) {
+		if (!OpHasCallBack(callBacks.axisTFuncPtr)) {
+			const float* ptr = c.data->start.asPtr(axis);
+			return OpRoots((intercept - ptr[0]) / (ptr[2] - ptr[0]));
+		}
+		return (*callBacks.axisTFuncPtr)(c, axis, intercept, matchEnds);
+	});
 }
 
 bool OpCurve::isLine() {
 	if (isLineSet)
 		return isLineResult;
 	isLineSet = true;
-	PathOpsV0Lib::CurveIsLine funcPtr = contours->callBack(c.type).curveIsLineFuncPtr;
-	OP_ASSERT(funcPtr);  // !!! can non-line omit this?
-	if (!funcPtr || (*funcPtr)(c)) {
+	bool line = dispatch([this](const auto& callBacks) {
+		OP_ASSERT(OpHasCallBack(callBacks.curveIsLineFuncPtr));  // !!! can non-line omit this?
+		return !OpHasCallBack(callBacks.curveIsLineFuncPtr) || (*callBacks.curveIsLineFuncPtr)(c);
+	});
+	if (line) {
 		c.type = contours->contextCallBacks.setLineTypeFuncPtr(c);
+		builtIn = contours->builtIn(c.type);
 		return isLineResult = true;
 	}
 	return false;
@@ -402,11 +503,11 @@ bool OpCurve::isLine() {
 // This works if the numbers are all very small (denormalized).
 // !!! Are there platforms that do not support denormalized numbers? Will this work there?
 // !!! If y is large, will this increase the error too much?
-bool OpCurve::isVertical() const {
-	if (firstPt().y == lastPt().y)
+bool OpCurve::IsVertical(OpPoint first, OpPoint last) {
+	if (first.y == last.y)
 		return false;
-	float epsilon = std::max(fabsf(firstPt().y), fabsf(lastPt().y)) * OpEpsilon;
-	return fabsf(firstPt().x) <= epsilon && fabsf(lastPt().x) <= epsilon; 
+	float epsilon = std::max(fabsf(first.y), fabsf(last.y)) * OpEpsilon;
+	return fabsf(first.x) <= epsilon && fabsf(last.x) <= epsilon; 
 }
 
 
@@ -421,15 +522,19 @@ bool OpCurve::debugIsLine() const {
 OpPointBounds OpCurve::ptBounds() const {
 	OpPointBounds result;
 	result.set(c.data->start, c.data->end);
-	PathOpsV0Lib::SetBounds funcPtr = contours->callBack(c.type).setBoundsFuncPtr;
-	if (funcPtr)
-		(*funcPtr)(c, result);
+	dispatch([this, &result](const auto& callBacks) {
+		if (OpHasCallBack(callBacks.setBoundsFuncPtr))
+			(*callBacks.setBoundsFuncPtr)(c, result);
+	});
 	return result;
 }
 
 void OpCurve::output(bool firstPt, bool lastPt  OP_DEBUG_PARAMS(int parentID)) {
 	contours->initOutOnce();
-	contours->callBack(c.type).curveOutputFuncPtr(c, firstPt, lastPt, contours->callerOutput);
+	if (contours->contextCallBacks.contourOutputFuncPtr)
+		contours->outputCurves.push_back(c);
+	else
+		contours->callBack(c.type).curveOutputFuncPtr(c, firstPt, lastPt, contours->callerOutput);
 #if OP_DEBUG && TEST_RASTER
 	if (contours->rasterEnabled) {
 		contours->sampleOutputs.addCurveXatY(c  OP_DEBUG_PARAMS(parentID));
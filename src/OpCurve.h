@@ -23,10 +23,20 @@ struct CutRangeT {
 	OpPtT hi;
 };
 
+// curve types whose callbacks match a curve in curves/; see OpCurveSet.h
+enum class BuiltInCurve : int8_t {
+	none,  // call through callbacks registered with context
+	line,
+	quad,
+	conic,
+	cubic
+};
+
 struct OpCurve {
 	OpCurve() 
 		: c{ nullptr, 0, (PathOpsV0Lib::CurveType) 0 }
 		, contours(nullptr)
+		, builtIn(BuiltInCurve::none)
 		, isLineSet(false)
 		, isLineResult(false) {
 	}
@@ -37,20 +47,26 @@ struct OpCurve {
 	float center(Axis offset, float axisIntercept) const;
 //	OpPtT cut(const OpPtT& ptT, float loBounds, float hiBounds, float direction) const;
 	CutRangeT cutRange(const OpPtT& ptT, OpPoint oppPt, float loEnd, float hiEnd) const;
+	template <typename Fn> auto dispatch(Fn ) const;
 //	OpPoint end(float t) const;
 //	OpPtT findIntersect(Axis offset, const OpPtT& ) const;
+	static BuiltInCurve FindBuiltIn(const PathOpsV0Lib::CurveCallBacks& );
 	OpPoint firstPt() const  {
 		return c.data->start; } 
 	OpPoint hullPt(int index) const;
 	float interceptLimit() const;
 	bool isFinite() const;
 	bool isLine(); 
-	bool isVertical() const;
+	bool isVertical() const {
+		return IsVertical(firstPt(), lastPt()); }
+	static bool IsVertical(OpPoint first, OpPoint last);
 	OpPoint lastPt() const {
 		return c.data->end; }
 	LinePts linePts() const {
 		LinePts result { firstPt(), lastPt() }; return result; }
 	OpRootPts lineIntersect(const LinePts& line) const;
+	OpRoots lineRayIntersect(const LinePts& line, MatchEnds ) const;  // requires line
+	LinePts lineToVertical(const LinePts& line, MatchEnds ) const;  // requires line
 	// Returns t of point on curve if any; returns NaN if no match. Used by line/curve intersection.
 	float match(float start, float end, OpPoint ) const;
 	MatchReverse matchEnds(const LinePts& ) const;
@@ -92,6 +108,7 @@ struct OpCurve {
 	// create storage in contour; helper function casts it to CurveData
 	PathOpsV0Lib::Curve c;
 	OpContours* contours;  // required by new interface for caller function pointer access
+	BuiltInCurve builtIn;  // set with c.type
 	bool isLineSet;
 	bool isLineResult;
 };
@@ -99,7 +116,8 @@ struct OpCurve {
 struct CurveDataStorage {
 	CurveDataStorage()
 		: next(nullptr)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 		OP_DEBUG_CODE(memset(storage, 0, sizeof(storage)));
 	}
 	PathOpsV0Lib::CurveData* curveData(size_t size) {
@@ -117,6 +135,7 @@ struct CurveDataStorage {
 	CurveDataStorage* next;
 	size_t used;
 	char storage[sizeof(OpPoint) * 256];
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 #if OP_DEBUG_IMAGE  
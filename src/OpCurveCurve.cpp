@@ -61,7 +61,7 @@ OpPtT CcCurves::Dist(const OpSegment* seg, const OpPtT& segPtT, const OpSegment*
 	OpRoots roots = opp->c.rayIntersect(normLine, MatchEnds::none);
 	float bestSq = OpInfinity;
 	OpPtT bestPtT(SetToNaN::dummy);
-	for (float root : roots.roots) {
+	for (float root : roots) {
 		OpPtT oppPtT = opp->c.ptTAtT(root);
 		float distSq = (segPtT.pt - oppPtT.pt).lengthSquared();
 		if (bestSq > distSq) {
@@ -88,11 +88,11 @@ float EdgeRun::setOppDist(const OpSegment* segment) {
 	return dist;
 }
 
-void EdgeRun::set(OpEdge* e, const OpSegment* oppSeg, EdgeMatch match) {
+void EdgeRun::set(OpEdge* e, const OpEdge* oppWhole, EdgeMatch match) {
 	edge = e;
-	oppEdge = const_cast<OpEdge*>(&oppSeg->edges[0]);  // !!! don't know about this...
+	oppEdge = const_cast<OpEdge*>(oppWhole);  // !!! don't know about this...
 	edgePtT = EdgeMatch::start == match ? edge->start() : edge->end();
-	oppPtT = CcCurves::Dist(edge->segment, edgePtT, oppSeg);
+	oppPtT = CcCurves::Dist(edge->segment, edgePtT, oppWhole->segment);
 	if (OpMath::IsFinite(oppPtT.t))
 		oppDist = setOppDist(edge->segment);
 	else
@@ -106,9 +106,9 @@ bool EdgeRun::inDeleted(CcCurves* curves, CcCurves* oppCurves) const {
 	return curves->deletedT(edgePtT.t) || oppCurves->deletedT(oppPtT.t);
 }
 
-void CcCurves::addEdgeRun(OpEdge* edge, const OpSegment* oppSeg, EdgeMatch match) {
+void CcCurves::addEdgeRun(OpEdge* edge, const OpEdge* oppWhole, EdgeMatch match) {
 	EdgeRun run;
-	run.set(edge, oppSeg, match);
+	run.set(edge, oppWhole, match);
 	if (OpMath::IsNaN(run.oppDist))
 		return;
 	EdgeRun* runStart = runs.size() ? &runs.front() : nullptr;
@@ -202,10 +202,10 @@ int CcCurves::groupCount() const {
 }
 #endif
 
-void CcCurves::initialEdgeRun(OpEdge* edge, const OpSegment* oppSeg) {
+void CcCurves::initialEdgeRun(OpEdge* edge, const OpEdge* oppWhole) {
 	for (EdgeMatch match : { EdgeMatch::start, EdgeMatch::end } ) {
 		EdgeRun run;
-		run.set(edge, oppSeg, match);
+		run.set(edge, oppWhole, match);
 		if (OpMath::IsNaN(run.oppDist))
 			continue;
 		runs.push_back(run);
@@ -240,21 +240,21 @@ float CcCurves::perimeter() const {
 // snip out the curve 16 units to the side of the intersection point, to prevent another closeby
 // intersection from also getting recorded. The units maybe t values, or may be x/y distances.
 void CcCurves::snipAndGo(const OpSegment* segment, const OpPtT& ptT, OpPoint oppPt, 
-		const OpSegment* oppSeg) {
+		const OpEdge* oppWhole) {
 	// snip distance must be large enough to differ in x/y and in t
 	CutRangeT tRange = segment->c.cutRange(ptT, oppPt, 0, 1);
 	OP_ASSERT(tRange.lo.t < tRange.hi.t);
 	// remove part or all of edges that overlap tRange
 	deleted.push_back(tRange);
-	snipRange(segment, tRange.lo, tRange.hi, oppSeg);
+	snipRange(segment, tRange.lo, tRange.hi, oppWhole);
 }
 
 void CcCurves::snipRange(const OpSegment* segment, const OpPtT& lo, const OpPtT& hi, 
-		const OpSegment* oppSeg) {
+		const OpEdge* oppWhole) {
 	CcCurves snips;
 	OpContours* contours = segment->contour->contours;
 	auto addSnip = [contours](const OpEdge* edge, const OpPtT& start, const OpPtT& end) {
-		void* block = contours->allocateEdge(contours->ccStorage);
+		void* block = contours->allocateEdge(contours->ccEdges());
 		OpEdge* newE = new(block) OpEdge(edge, start, end  OP_LINE_FILE_PARGS());
 		newE->ccOverlaps = true;
 		return newE;
@@ -271,7 +271,7 @@ void CcCurves::snipRange(const OpSegment* segment, const OpPtT& lo, const OpPtT&
 			snipE->ccStart = edge->ccStart;
 			snipE->ccSmall = edge->ccSmall;
 			snipE->ccEnd = true;
-			addEdgeRun(snipE, oppSeg, EdgeMatch::end);
+			addEdgeRun(snipE, oppWhole, EdgeMatch::end);
 			OP_ASSERT(!snipE->disabled);
 			snips.c.push_back(snipE);
 		}
@@ -280,7 +280,7 @@ void CcCurves::snipRange(const OpSegment* segment, const OpPtT& lo, const OpPtT&
 			snipS->ccStart = true;
 			snipS->ccEnd = edge->ccEnd;
 			snipS->ccLarge = edge->ccLarge;
-			addEdgeRun(snipS, oppSeg, EdgeMatch::start);
+			addEdgeRun(snipS, oppWhole, EdgeMatch::start);
 			OP_ASSERT(!snipS->disabled);
 			snips.c.push_back(snipS);
 		}
@@ -292,6 +292,8 @@ OpCurveCurve::OpCurveCurve(OpSegment* s, OpSegment* o)
 	: contours(s->contour->contours)
 	, seg(s)
 	, opp(o)
+	, segWhole(s  OP_LINE_FILE_PARGS())
+	, oppWhole(o  OP_LINE_FILE_PARGS())
 	, depth(0)
 	, uniqueLimits_impl(-1)
 	, unsplitables(0)
@@ -303,11 +305,9 @@ OpCurveCurve::OpCurveCurve(OpSegment* s, OpSegment* o)
 	, splitHullFail(false)
 {
 #if OP_DEBUG_DUMP
-	++debugCall;
-	debugLocalCall = debugCall;  // copied so value is visible in debugger
+	debugLocalCall = ++contours->debugCurveCurveCall;  // copied so value is visible in debugger
 	contours->debugCurveCurve = this;
 #endif
-//	contours->reuse(contours->ccStorage);
 	PathOpsV0Lib::ContextCallBacks& cb = contours->contextCallBacks;
 	maxSignSwap = cb.maxSignSwapFuncPtr ? cb.maxSignSwapFuncPtr(s->c.c, o->c.c) : 131072.f;
 	maxSplits = cb.maxSplitsFuncPtr ? cb.maxSplitsFuncPtr(s->c.c, o->c.c) : 8;
@@ -317,8 +317,6 @@ OpCurveCurve::OpCurveCurve(OpSegment* s, OpSegment* o)
 	smallTFound = MatchEnds::start & matchRev.match;
 	largeTFound = MatchEnds::end & matchRev.match;
 	splitMid = smallTFound || largeTFound;
-	seg->edges.clear();
-	opp->edges.clear();
 	OpPtT segS {seg->c.firstPt(), 0 };
 	OpPtT segE {seg->c.lastPt(), 1 };
 	OpPtT oppS {opp->c.firstPt(), 0 };
@@ -335,23 +333,20 @@ OpCurveCurve::OpCurveCurve(OpSegment* s, OpSegment* o)
 				OP_LINE_FILE_STRUCT() };
 		limits.push_back(std::move(lgT));
 	}
-	// if ends of segments already touch, exclude from made edge
-	seg->makeEdge(OP_LINE_FILE_NPARGS());
 	if (matchRev.reversed)
 		std::swap(oppS, oppE);
-	opp->makeEdge(OP_LINE_FILE_NPARGS());
-	OpEdge* edge = &seg->edges.back();
+	OpEdge* edge = &segWhole;
 	edge->ccStart = edge->ccSmall = smallTFound;
 	edge->ccEnd = edge->ccLarge = largeTFound;
 	OP_ASSERT(!edge->disabled);
 	edgeCurves.oppCurves = &oppCurves;
 	oppCurves.oppCurves = &edgeCurves;
 	edgeCurves.c.push_back(edge);
-	edgeCurves.initialEdgeRun(edge, opp);
-	OpEdge* oppEdge = &opp->edges.back();
+	edgeCurves.initialEdgeRun(edge, &oppWhole);
+	OpEdge* oppEdge = &oppWhole;
 	OP_ASSERT(!oppEdge->disabled);
 	oppCurves.c.push_back(oppEdge);
-	oppCurves.initialEdgeRun(oppEdge, seg);
+	oppCurves.initialEdgeRun(oppEdge, &segWhole);
 	if (matchRev.reversed)
 		std::swap(smallTFound, largeTFound);
 	oppEdge->ccStart = oppEdge->ccSmall = smallTFound;
@@ -368,7 +363,7 @@ OpCurveCurve::OpCurveCurve(OpSegment* s, OpSegment* o)
 
 void OpCurveCurve::addEdgeRun(OpEdge* edge, CurveRef curveRef, EdgeMatch match) {
 	CcCurves& curves = CurveRef::edge == curveRef ? edgeCurves : oppCurves;
-	curves.addEdgeRun(edge, CurveRef::edge == curveRef ? opp : seg, match);
+	curves.addEdgeRun(edge, CurveRef::edge == curveRef ? &oppWhole : &segWhole, match);
 }
 
 void OpCurveCurve::addIntersection(OpEdge* edge, OpEdge* oppEdge) {
@@ -442,6 +437,7 @@ bool OpCurveCurve::addUnsectable(const OpPtT& edgeStart, const OpPtT& edgeEnd,
 	if (sect1.o && sect1.o == sect2.o)
 		return false;
 	int usectID = seg->nextID();
+	++(IsCoin::yes == isCoin ? contours->stats.coincidences : contours->stats.unsectables);
 	auto idEnds = [usectID, &match, isCoin](IsOpp isOpp) {
 		IdEnds idEnds {
 			match.reversed && (IsOpp::yes == isOpp || IsCoin::yes == isCoin) ? -usectID : usectID,
@@ -587,7 +583,7 @@ bool OpCurveCurve::checkSplit(float loT, float hiT, CurveRef which, OpPtT& check
 				return original != checkPtT;
 		}
 		// check for gap between original and edge list, and between edges in edge list
-		const OpEdge& oEdge = CurveRef::edge == which ? opp->edges[0] : seg->edges[0];
+		const OpEdge& oEdge = CurveRef::edge == which ? oppWhole : segWhole;
 		OpPtT delLo = oEdge.start();
 		auto checkBounds = [checkPtT](const OpPtT& lo, const OpPtT& hi) {
 			OpPointBounds delBounds(lo.pt, hi.pt);
@@ -681,6 +677,8 @@ SectFound OpCurveCurve::divideAndConquer() {
 //		edgeCurves.endDist(seg, opp);
 //		oppCurves.endDist(opp, seg);
 		OP_ASSERT(debugShowImage(true));
+		if (contours->aborted())  // storage exhausted or caller cancelled
+			return SectFound::fail;
 		bool snipEm = false;
 		if (!setOverlaps())
 			return SectFound::fail;
@@ -742,8 +740,8 @@ SectFound OpCurveCurve::divideAndConquer() {
 			snipEm = setSnipFromLimits(limitCount);
 		}
 		if (snipEm) {
-			edgeCurves.snipAndGo(seg, snipEdge, snipOpp.pt, opp);
-			oppCurves.snipAndGo(opp, snipOpp, snipEdge.pt, seg);
+			edgeCurves.snipAndGo(seg, snipEdge, snipOpp.pt, &oppWhole);
+			oppCurves.snipAndGo(opp, snipOpp, snipEdge.pt, &segWhole);
 		}
 	}
 //	OP_ASSERT(0);  // !!! if this occurs likely more code is needed
@@ -936,7 +934,7 @@ bool OpCurveCurve::reduceDistFlipped() {
 		size_t lodex = OpMax;
 		size_t hidex = OpMax;
 		auto keepRun = [&lower, &upper, this](CcCurves& splits) {
-			void* block = contours->allocateEdge(contours->ccStorage);
+			void* block = contours->allocateEdge(contours->ccEdges());
 			OpEdge* split = new(block) OpEdge(lower->edge, lower->edgePtT.t, 
 					upper->edgePtT.t  OP_LINE_FILE_PARGS());
 			split->ccOverlaps = true;
@@ -1217,8 +1215,8 @@ bool OpCurveCurve::splitDownTheMiddle(const OpEdge& edge, const OpPtT& edgeMid,
 	OP_ASSERT(edge.startT < edgeMid.t);
 	OP_ASSERT(edgeMid.t < edge.endT);
 	CcCurves& curves = CurveRef::edge == curveRef ? edgeCurves : oppCurves;
-	const OpSegment* oppSeg = CurveRef::edge == curveRef ? opp : seg;
-	void* blockL = contours->allocateEdge(contours->ccStorage);
+	const OpEdge* oppEdge = CurveRef::edge == curveRef ? &oppWhole : &segWhole;
+	void* blockL = contours->allocateEdge(contours->ccEdges());
 	OpEdge* splitLeft = new(blockL) OpEdge(&edge, edgeMid, NewEdge::isLeft  
 			OP_LINE_FILE_PARGS());
 	if (!splitLeft->disabled) {
@@ -1227,9 +1225,9 @@ bool OpCurveCurve::splitDownTheMiddle(const OpEdge& edge, const OpPtT& edgeMid,
 		splitLeft->ccSmall = edge.ccSmall;
 		OP_ASSERT(!splitLeft->disabled);
 		splits.c.push_back(splitLeft);
-		curves.addEdgeRun(splitLeft, oppSeg, EdgeMatch::end);
+		curves.addEdgeRun(splitLeft, oppEdge, EdgeMatch::end);
 	}
-	void* blockR = contours->allocateEdge(contours->ccStorage);
+	void* blockR = contours->allocateEdge(contours->ccEdges());
 	OpEdge* splitRight = new(blockR) OpEdge(&edge, edgeMid, NewEdge::isRight  
 			OP_LINE_FILE_PARGS());
 	if (!splitRight->disabled) {
@@ -1352,7 +1350,7 @@ bool OpCurveCurve::splitHulls(CurveRef which, CcCurves& splits) {
 				continue;
 			if (OpMath::EqualT(hullLo.sect.t, hullHi.sect.t))
 				continue;
-			void* block = contours->allocateEdge(contours->ccStorage);
+			void* block = contours->allocateEdge(contours->ccEdges());
 			OpEdge* split = new(block) OpEdge(&edge, hullLo.sect.t, 
 					hullHi.sect.t  OP_LINE_FILE_PARGS());
 			if (split->disabled)
@@ -56,7 +56,7 @@ inline CurveRef operator!(CurveRef a) {
 
 // distance from edge to opp at this edge t, and number of edges between this and next
 struct EdgeRun {
-	void set(OpEdge* , const OpSegment* opp, EdgeMatch );
+	void set(OpEdge* , const OpEdge* oppWhole, EdgeMatch );
 	bool inDeleted(CcCurves* , CcCurves* oppCurves) const;
 	float setOppDist(const OpSegment* segment);
 	DUMP_DECLARATIONS
@@ -74,7 +74,7 @@ struct EdgeRun {
 };
 
 struct CcCurves {
-	void addEdgeRun(OpEdge* , const OpSegment* oppSeg, EdgeMatch );
+	void addEdgeRun(OpEdge* , const OpEdge* oppWhole, EdgeMatch );
 	bool checkMid(size_t index); // true if mid pt dist between this and next run dist is smaller
 	void clear();
 	OpPtT closest(OpPoint pt) const;
@@ -82,13 +82,13 @@ struct CcCurves {
 	static OpPtT Dist(const OpSegment* , const OpPtT& segPtT, const OpSegment* opp);
 	std::vector<CutRangeT> findGaps() const;
 	int groupCount() const;
-	void initialEdgeRun(OpEdge* edge, const OpSegment* oppSeg);
+	void initialEdgeRun(OpEdge* edge, const OpEdge* oppWhole);
 	void markToDelete(float tStart, float tEnd);
 	int overlaps() const;
 	float perimeter() const;
-	void snipAndGo(const OpSegment* , const OpPtT& cut, OpPoint oppPt, const OpSegment* oppSeg);
+	void snipAndGo(const OpSegment* , const OpPtT& cut, OpPoint oppPt, const OpEdge* oppWhole);
 	// void snipOne(const OpSegment* , const OpPtT& lo, const OpPtT& hi);
-	void snipRange(const OpSegment* , const OpPtT& lo, const OpPtT& hi, const OpSegment* oppSeg);
+	void snipRange(const OpSegment* , const OpPtT& lo, const OpPtT& hi, const OpEdge* oppWhole);
 	DUMP_DECLARATIONS
 
 	std::vector<OpEdge*> c;
@@ -163,6 +163,8 @@ struct OpCurveCurve {
 	OpContours* contours;
 	OpSegment* seg;
 	OpSegment* opp;
+	OpEdge segWhole;  // owned here, not by segment, so pairs sharing a segment can run in parallel
+	OpEdge oppWhole;
 	CcCurves edgeCurves;
 	CcCurves oppCurves;
 	std::vector<FoundLimits> limits;
@@ -185,7 +187,6 @@ struct OpCurveCurve {
 	bool splitMid;
 	bool splitHullFail;  // set true if mid t is nearly equal to an end 
 #if OP_DEBUG_DUMP
-	static int debugCall;
 	int debugLocalCall;  // (copy so it is visible in debugger)
 #endif
 #if OP_DEBUG_VERBOSE
@@ -0,0 +1,94 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpCurveSet_DEFINED
+#define OpCurveSet_DEFINED
+
+// The curves in curves/ are known when the engine is compiled. A curve type registered with
+// exactly the callbacks of one of them is dispatched statically by OpCurve: each callback is a
+// compile-time constant, so calls are direct and can be inlined into hot loops. Curve types with
+// other callbacks are called through the callbacks registered with the context.
+// The curve headers have no include guards; include this only where they are not included.
+
+#include "curves/Line.h"
+#include "curves/QuadBezier.h"
+#include "curves/ConicBezier.h"
+#include "curves/CubicBezier.h"
+
+// true if the curve type has the callback; for built-in curves, known when compiled
+template <typename FuncPtr>
+constexpr bool OpHasCallBack(FuncPtr funcPtr) {
+	return nullptr != funcPtr;
+}
+
+// members have the same names as CurveCallBacks, so dispatched code reads the same for both
+template <PathOpsV0Lib::AxisT axisT = nullptr,
+		PathOpsV0Lib::CurveHull curveHull = nullptr,
+		PathOpsV0Lib::CurveIsFinite curveIsFinite = nullptr,
+		PathOpsV0Lib::CurveIsLine curveIsLine = nullptr,
+		PathOpsV0Lib::SetBounds setBounds = nullptr,
+		PathOpsV0Lib::CurvePinCtrl curvePinCtrl = nullptr,
+		PathOpsV0Lib::CurveTangent curveTangent = nullptr,
+		PathOpsV0Lib::CurvesEqual curvesEqual = nullptr,
+		PathOpsV0Lib::PtAtT ptAtT = nullptr,
+		PathOpsV0Lib::HullPtCount ptCount = nullptr,
+		PathOpsV0Lib::Rotate rotate = nullptr,
+		PathOpsV0Lib::SubDivide subDivide = nullptr,
+		PathOpsV0Lib::XYAtT xyAtT = nullptr,
+		PathOpsV0Lib::CurveReverse curveReverse = nullptr,
+		PathOpsV0Lib::CurveConst cut = nullptr,
+		PathOpsV0Lib::CurveConst normalLimit = nullptr,
+		PathOpsV0Lib::CurveConst intercept = nullptr>
+struct OpCurveFuncs {
+	static constexpr PathOpsV0Lib::AxisT axisTFuncPtr = axisT;
+	static constexpr PathOpsV0Lib::CurveHull curveHullFuncPtr = curveHull;
+	static constexpr PathOpsV0Lib::CurveIsFinite curveIsFiniteFuncPtr = curveIsFinite;
+	static constexpr PathOpsV0Lib::CurveIsLine curveIsLineFuncPtr = curveIsLine;
+	static constexpr PathOpsV0Lib::SetBounds setBoundsFuncPtr = setBounds;
+	static constexpr PathOpsV0Lib::CurvePinCtrl curvePinCtrlFuncPtr = curvePinCtrl;
+	static constexpr PathOpsV0Lib::CurveTangent curveTangentFuncPtr = curveTangent;
+	static constexpr PathOpsV0Lib::CurvesEqual curvesEqualFuncPtr = curvesEqual;
+	static constexpr PathOpsV0Lib::PtAtT ptAtTFuncPtr = ptAtT;
+	static constexpr PathOpsV0Lib::HullPtCount ptCountFuncPtr = ptCount;
+	static constexpr PathOpsV0Lib::Rotate rotateFuncPtr = rotate;
+	static constexpr PathOpsV0Lib::SubDivide subDivideFuncPtr = subDivide;
+	static constexpr PathOpsV0Lib::XYAtT xyAtTFuncPtr = xyAtT;
+	static constexpr PathOpsV0Lib::CurveReverse curveReverseFuncPtr = curveReverse;
+	static constexpr PathOpsV0Lib::CurveConst cutFuncPtr = cut;
+	static constexpr PathOpsV0Lib::CurveConst normalLimitFuncPtr = normalLimit;
+	static constexpr PathOpsV0Lib::CurveConst interceptFuncPtr = intercept;
+
+	// the output callback is the caller's, and is not compared
+	static bool Matches(const PathOpsV0Lib::CurveCallBacks& c) {
+		return axisT == c.axisTFuncPtr && curveHull == c.curveHullFuncPtr
+				&& curveIsFinite == c.curveIsFiniteFuncPtr && curveIsLine == c.curveIsLineFuncPtr
+				&& setBounds == c.setBoundsFuncPtr && curvePinCtrl == c.curvePinCtrlFuncPtr
+				&& curveTangent == c.curveTangentFuncPtr && curvesEqual == c.curvesEqualFuncPtr
+				&& ptAtT == c.ptAtTFuncPtr && ptCount == c.ptCountFuncPtr
+				&& rotate == c.rotateFuncPtr && subDivide == c.subDivideFuncPtr
+				&& xyAtT == c.xyAtTFuncPtr && curveReverse == c.curveReverseFuncPtr
+				&& cut == c.cutFuncPtr && normalLimit == c.normalLimitFuncPtr
+				&& intercept == c.interceptFuncPtr;
+	}
+};
+
+// same callbacks, in the same order, as SetSkiaCurveCallBacks and the Path2D interface
+using OpLineFuncs = OpCurveFuncs<>;
+
+using OpQuadFuncs = OpCurveFuncs<PathOpsV0Lib::quadAxisT, PathOpsV0Lib::quadHull,
+		PathOpsV0Lib::quadIsFinite, PathOpsV0Lib::quadIsLine, PathOpsV0Lib::quadSetBounds,
+		PathOpsV0Lib::quadPinCtrl, PathOpsV0Lib::quadTangent, PathOpsV0Lib::quadsEqual,
+		PathOpsV0Lib::quadPtAtT, PathOpsV0Lib::quadHullPtCount, PathOpsV0Lib::quadRotate,
+		PathOpsV0Lib::quadSubDivide, PathOpsV0Lib::quadXYAtT>;
+
+using OpConicFuncs = OpCurveFuncs<PathOpsV0Lib::conicAxisT, PathOpsV0Lib::conicHull,
+		PathOpsV0Lib::conicIsFinite, PathOpsV0Lib::conicIsLine, PathOpsV0Lib::conicSetBounds,
+		PathOpsV0Lib::quadPinCtrl, PathOpsV0Lib::conicTangent, PathOpsV0Lib::conicsEqual,
+		PathOpsV0Lib::conicPtAtT, PathOpsV0Lib::quadHullPtCount, PathOpsV0Lib::conicRotate,
+		PathOpsV0Lib::conicSubDivide, PathOpsV0Lib::conicXYAtT>;
+
+using OpCubicFuncs = OpCurveFuncs<PathOpsV0Lib::cubicAxisT, PathOpsV0Lib::cubicHull,
+		PathOpsV0Lib::cubicIsFinite, PathOpsV0Lib::cubicIsLine, PathOpsV0Lib::cubicSetBounds,
+		PathOpsV0Lib::cubicPinCtrl, PathOpsV0Lib::cubicTangent, PathOpsV0Lib::cubicsEqual,
+		PathOpsV0Lib::cubicPtAtT, PathOpsV0Lib::cubicHullPtCount, PathOpsV0Lib::cubicRotate,
+		PathOpsV0Lib::cubicSubDivide, PathOpsV0Lib::cubicXYAtT, PathOpsV0Lib::cubicReverse>;
+
+#endif
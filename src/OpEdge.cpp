@@ -286,8 +286,7 @@ void OpEdge::apply() {
 		setDisabled(OP_LINE_FILE_NPARGS());
 	if (disabled || Unsortable::none != isUnsortable)
 		return;
-	OpContour* contour = segment->contour;
-	PathOpsV0Lib::WindKeep keep = contour->callBacks.windingKeepFuncPtr(winding.w, sum.w);
+	PathOpsV0Lib::WindKeep keep = winding.keep(sum);
 	switch (keep) {
 		case PathOpsV0Lib::WindKeep::Discard:
 			setDisabled(OP_LINE_FILE_NPARGS());
@@ -499,20 +498,31 @@ void OpEdge::output(bool closed) {
 	edge->outputLinkedList(firstEdge, true);
 }
 
+// iterates rather than recurses so that contours with many edges do not exhaust the stack
 void OpEdge::outputLinkedList(const OpEdge* firstEdge, bool first)
 {
-	OP_DEBUG_CODE(debugOutPath = curve.contours->debugOutputID);
-	OpEdge* next = nextOut();
-	OpCurve copy = curve;
-	if (EdgeMatch::end == which())
-		copy.reverse();
-	copy.output(first, firstEdge == next  OP_DEBUG_PARAMS(id));
-	if (firstEdge == next) {
-		OP_DEBUG_CODE(debugOutPath = curve.contours->nextID());
-		return;
+	OpContours* contours = curve.contours;
+	PathOpsV0Lib::ContourOutput contourOutput = contours->contextCallBacks.contourOutputFuncPtr;
+	if (contourOutput)
+		contours->outputCurves.clear();
+	OpEdge* edge = this;
+	for (;;) {
+		OP_DEBUG_CODE(edge->debugOutPath = contours->debugOutputID);
+		OpEdge* next = edge->nextOut();
+		OpCurve copy = edge->curve;
+		if (EdgeMatch::end == edge->which())
+			copy.reverse();
+		copy.output(first, firstEdge == next  OP_DEBUG_PARAMS(edge->id));
+		if (firstEdge == next)
+			break;
+		OP_ASSERT(next);
+		edge = next;
+		first = false;
 	}
-	OP_ASSERT(next);
-	next->outputLinkedList(firstEdge, false);
+	OP_DEBUG_CODE(edge->debugOutPath = contours->nextID());
+	if (contourOutput)
+		(*contourOutput)(contours->outputCurves.data(), contours->outputCurves.size(),
+				contours->callerOutput);
 }
 
 // in function to make setting breakpoints easier
@@ -625,6 +635,10 @@ void OpEdge::setPriorEdge(OpEdge* edge) {
 
 void OpEdge::setUnsortable(Unsortable unsortable) {  // setter exists so breakpoints can be set
 	isUnsortable = unsortable;
+	static_assert((int) Unsortable::underflow + 1 
+			== sizeof(PathOpsV0Lib::ContextStats::unsortables) / sizeof(size_t));
+	if (segment)  // fillers have no segment
+		++contours()->stats.unsortables[(int) unsortable];
 }
 
 const OpCurve& OpEdge::setVertical(const LinePts& pts, MatchEnds match) {
@@ -670,9 +684,7 @@ CalcFail OpEdge::subIfDL(Axis axis, float edgeInsideT, OpWinding* sumWinding) {
 void OpEdge::setSum(const PathOpsV0Lib::Winding& w  OP_LINE_FILE_ARGS()) {
 	OP_ASSERT(!sum.contour);
 	sum.contour = segment->contour;
-	sum.w.data = contours()->allocateWinding(w.size);
-	memcpy(sum.w.data, w.data, w.size);
-	sum.w.size = w.size;
+	sum.setData(w);
 #if OP_DEBUG_MAKER
 	debugSetSum = { fileName, lineNo };
 #endif
@@ -736,8 +748,10 @@ bool OpEdgeStorage::contains(OpPoint start, OpPoint end) const {
 }
 
 void OpEdgeStorage::reuse() {
-	for (int index = 0; index < used; ++index)
+	for (int index = 0; index < used; ++index) {
 		storage[index].~OpEdge();
+		new (&storage[index]) OpEdge();  // block destructor expects constructed edges
+	}
 	used = 0;
 	next = nullptr;
 }
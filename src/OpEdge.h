@@ -219,6 +219,7 @@ struct CoinPal {
 
 struct OpEdge {
 		friend struct OpEdgeStorage;
+		friend struct OpReserveStorage;
 #if !OP_DEBUG_DUMP
 private:
 #endif
@@ -462,7 +463,8 @@ enum class DumpStorage {
 struct OpEdgeStorage {
 	OpEdgeStorage()
 		: next(nullptr)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 	}
 	bool contains(OpIntersection* start, OpIntersection* end) const;
 	bool contains(OpPoint start, OpPoint end) const;
@@ -479,6 +481,7 @@ struct OpEdgeStorage {
 	OpEdgeStorage* next;
 	OpEdge storage[256];
 	int used;
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 #define OP_EDGE_SET_SUM(edge, winding) edge->setSum(winding  OP_LINE_FILE_PARGS())
@@ -190,6 +190,7 @@ void OpIntersections::coinRange(OpEdge& edge, OpSegment* opp, bool reversed) {
 				coinEnd->zeroCoincidenceID();
 			} else {
 				coinID = opp->nextID();
+				++opp->contour->contours->stats.coincidences;
 				edgeStart = setCoin(sect, MatchEnds::start);
 			}
 		} else if (t == edge.endT) {
@@ -203,7 +203,8 @@ struct OpIntersections {
 struct OpSectStorage {
 	OpSectStorage()
 		: next(nullptr)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 	}
 #if OP_DEBUG_DUMP
 	int debugCount() const;
@@ -216,6 +217,7 @@ struct OpSectStorage {
 	OpSectStorage* next;
 	OpIntersection storage[256];
 	int used;
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 #endif
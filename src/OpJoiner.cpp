@@ -244,6 +244,8 @@ OpTree::OpTree(OpJoiner& join)
 	join.edge->lastEdge->endSeen = true;
 	// !!! can I know that join.edge never has prior, and is never loop?
 	do {
+		if (contours->aborted())
+			return;
 		initialize(join);
 		if (LimbPass::disabledPals == limbPass) {
 			OpLimb* unsectEnd = unsectableLoop();
@@ -256,6 +258,8 @@ OpTree::OpTree(OpJoiner& join)
 			int index = 0;
 			do {
 				nthLimb(index).addEach(join, *this);
+				if (contours->aborted())
+					return;  // storage exhausted or caller cancelled
 				if (totalUsed > maxLimbs) {
 			#if 0 // TEST_ANALYZE // for grshapearcs 
 					playback();
@@ -305,6 +309,8 @@ void OpTree::addDisabled(OpJoiner& join) {
 				addPal(EdgeMatch::start);
 			if (limb.tryAdd(*this, test, EdgeMatch::end, LimbPass::disabledPals))
 				addPal(EdgeMatch::end);
+			if (contours->aborted())
+				return;  // storage exhausted or caller cancelled
 		} while (++index < totalUsed);
 	}
 }
@@ -451,8 +457,10 @@ OpLimb& OpTree::nthLimb(int index) {
 }
 
 OpLimb* OpTree::makeLimb() {
-	++totalUsed;
-	return contours->allocateLimb();
+	OpLimb* limb = contours->allocateLimb();
+	if (PathOpsV0Lib::ContextError::memory != contours->error)
+		++totalUsed;  // limbs from the reserve can't be found by index
+	return limb;
 }
 
 bool OpTree::preferSibling(OpLimb* palParent, OpEdge* edge) {
@@ -1028,6 +1036,8 @@ bool OpJoiner::matchLinks(bool popLast) {
 		} else {
 			tree.bestLimb = gap;
 		}
+		if (tree.contours->aborted())
+			return false;  // storage exhausted or caller cancelled
 	}
 	return tree.join(*this);
 }
@@ -190,7 +190,8 @@ struct OpLimbStorage {
 		: nextBlock(nullptr)
 		, prevBlock(nullptr)
 		, baseIndex(0)
-		, used(0) {
+		, used(0)
+		, callerOwned(false) {
 		static_assert(((ARRAY_COUNT(storage) - 1) & ARRAY_COUNT(storage)) == 0);
 	}
 	OpLimb* allocate();
@@ -208,6 +209,7 @@ struct OpLimbStorage {
 	OpLimb storage[256];
 	int baseIndex;
 	int used;
+	bool callerOwned;  // if true, memory came from caller's allocator
 };
 
 
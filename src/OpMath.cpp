@@ -5,36 +5,38 @@
 // if t is nearly end of range, make it end of range
 // motivation for this is test cubics_d, which generates yExtrema very nearly equal to 1.
 // 'interior' is only used for extrema and inflections
-OpRoots OpRoots::keepInteriorTs(float start, float end) {
+// roots are filtered in place; kept roots move toward the front
+OpRoots& OpRoots::keepInteriorTs(float start, float end) {
 	(void) keepValidTs(start, end);
-	OpRoots interior;
-	for (float tValue : roots) {
+	int interior = 0;
+	for (float tValue : *this) {
 		if (start >= tValue - OpEpsilon || tValue + OpEpsilon >= end)
 			continue;
-		interior.roots.push_back(tValue);
+		roots[interior++] = tValue;
 	}
-	std::swap(interior.roots, roots);
+	used = interior;
 	return *this;
 }
 
-OpRoots OpRoots::keepValidTs(float start, float end) {
-	OpRoots validTs;
-	for (float tValue : roots) {
+OpRoots& OpRoots::keepValidTs(float start, float end) {
+	int validTs = 0;
+	for (int index = 0; index < used; ++index) {
+		float tValue = roots[index];
 		if (OpMath::IsNaN(tValue) || start > tValue || tValue > end)
 			continue;
 		if (tValue < start + OpEpsilon)
 			tValue = start;
 		else if (tValue > end - OpEpsilon)
 			tValue = end;
-		for (float alreadyFound : validTs.roots) {
-			if (alreadyFound == tValue)
+		for (int found = 0; found < validTs; ++found) {
+			if (roots[found] == tValue)
 				goto notUnique;
 		}
-		validTs.roots.push_back(tValue);
+		roots[validTs++] = tValue;
 	notUnique:
 		;
 	}
-	std::swap(validTs.roots, roots);
+	used = validTs;
 	return *this;
 }
 
@@ -77,41 +77,46 @@ enum class RootFail {
 // lines, cubics, and quads only need 2 but reserving three simplifies things,
 // just as all curves reserve 4 points, even though all but cubics need 2 or 3
 // then add two more in case error in root finding misses roots at zero and one
+// roots are stored inline so that finding them does not allocate
 struct OpRoots {
 	OpRoots() 
-		: fail(RootFail::none) {
-		roots.reserve(5);
+		: used(0)
+		, fail(RootFail::none) {
 	}
 
 	OpRoots(RootFail f)
-		: fail(f) {
+		: used(0)
+		, fail(f) {
 	}
 
 	OpRoots(float one)
-		: fail(RootFail::none) {
-		roots.reserve(5);
-		roots.push_back(one);
+		: used(0)
+		, fail(RootFail::none) {
+		add(one);
 	}
 
 	OpRoots(float one, float two)
-		: fail(RootFail::none) {
-		roots.reserve(5);
-		if (one == two)
-			roots.push_back(one);
-		else
-			roots.insert(roots.end(), { one, two } );
+		: used(0)
+		, fail(RootFail::none) {
+		add(one);
+		if (one != two)
+			add(two);
 	}
 
 	// testing only
 #if OP_RELEASE_TEST
 	OpRoots(float one, float two, float three)
-		: fail(RootFail::none) {
-		roots.insert(roots.end(), { one, two, three } );
+		: used(0)
+		, fail(RootFail::none) {
+		add(one);
+		add(two);
+		add(three);
 	}
 #endif
 
 	void add(float root) {
-		roots.push_back(root);
+		OP_ASSERT(used < (int) roots.size());
+		roots[used++] = root;
 	}
 
 	void addEnd(float root) {
@@ -121,8 +126,11 @@ struct OpRoots {
 		add(root);
 	}
 
+	const float* begin() const {
+		return roots.data(); }
+
 	bool contains(float check) const {
-		for (float f : roots) {
+		for (float f : *this) {
 			if (check == f)
 				return true;
 		}
@@ -130,31 +138,35 @@ struct OpRoots {
 	}
 
 	int count() const {
-		return (int) roots.size();
+		return used;
 	}
 
+	const float* end() const {
+		return roots.data() + used; }
+
 	float get(unsigned index) {
-		OP_ASSERT(index < roots.size());
+		OP_ASSERT((int) index < used);
 		return roots[index];
 	}
 
-	OpRoots keepValidTs(float start = 0, float end = 1);
-	OpRoots keepInteriorTs(float start = 0, float end = 1);
+	OpRoots& keepValidTs(float start = 0, float end = 1);
+	OpRoots& keepInteriorTs(float start = 0, float end = 1);
 
 	float* last() {
-		OP_ASSERT(roots.size());
-		return &roots.back();
+		OP_ASSERT(used);
+		return &roots[used - 1];
 	}
 
 	// void prioritize01();
 
 	void sort() {
-		std::sort(roots.begin(), roots.end());
+		std::sort(roots.begin(), roots.begin() + used);
 	}
 
 	DUMP_DECLARATIONS
 
-	std::vector<float> roots;
+	std::array<float, 5> roots;
+	int used;  // number of entries in roots
 	RootFail fail;
 };
 
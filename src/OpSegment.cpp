@@ -41,6 +41,7 @@ OpSegment::OpSegment(PathOpsV0Lib::Contour* libContour, PathOpsV0Lib::AddCurve a
 	, hasUnsectable(false)
 	, startMoved(false)
 	, endMoved(false) {
+	++contour->contours->stats.segments;
 	if (!c.isFinite()) {
 		contour->contours->setError(PathOpsV0Lib::ContextError::finite  OP_DEBUG_PARAMS(id));
 		disabled = true;
@@ -408,6 +409,7 @@ SegPt OpSegment::checkAliases(OpPtT match) {
 int OpSegment::coinID(bool flipped) {
 	int coinID = nextID();
 	hasCoin = true;
+	++contour->contours->stats.coincidences;
 	return flipped ? -coinID : coinID;
 }
 
@@ -613,11 +615,6 @@ void OpSegment::makeCoins() {
 	}
 }
 
-void OpSegment::makeEdge(OP_LINE_FILE_NP_ARGS()) {
-	if (!edges.size()) 
-		edges.emplace_back(this  OP_LINE_FILE_PARGS());
-}
-
 void OpSegment::makeEdges() {
 	edges.clear();
 	if (disabled)
@@ -625,6 +622,7 @@ void OpSegment::makeEdges() {
 	OP_ASSERT(sects.i.size());
 	edges.reserve(sects.i.size());
 	sects.makeEdges(this);
+	contour->contours->stats.edges += edges.size();
 }
 
 // create list of unsectable edges that match previous found unsectable intersections.
@@ -101,7 +101,6 @@ struct OpSegment {
 //        return 1 == edges.size() && 2 == sects.i.size(); }
 	bool isSmall();
 	void makeCoins();
-	void makeEdge(OP_LINE_FILE_NP_ARGS());
 	void makeEdges();
 	void makePals();
 	OpPtT matchEnd(OpPoint opp) const;
@@ -5,6 +5,11 @@
 #include "OpSegment.h"
 #include "OpSegments.h"
 #include "OpWinder.h"
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <unordered_map>
 
 static bool compareXBox(const OpSegment* s1, const OpSegment* s2) {
 	const OpRect& r1 = s1->ptBounds;
@@ -20,6 +25,43 @@ static bool compareXBox(const OpSegment* s1, const OpSegment* s2) {
 	return s1->id < s2->id;
 }
 
+// segments that are totally coincident share bounds, curve type, and end points in either order
+struct CoincidentKey {
+	CoincidentKey(const OpSegment* seg)
+		: bounds(seg->ptBounds)
+		, start(seg->c.firstPt())
+		, end(seg->c.lastPt())
+		, type(seg->c.c.type) {
+		if (end.x < start.x || (end.x == start.x && end.y < start.y))
+			std::swap(start, end);
+	}
+
+	friend bool operator==(const CoincidentKey& a, const CoincidentKey& b) {
+		return a.bounds == b.bounds && a.start == b.start && a.end == b.end && a.type == b.type;
+	}
+
+	OpRect bounds;
+	OpPoint start;  // lesser of end points in x, then y
+	OpPoint end;
+	PathOpsV0Lib::CurveType type;
+};
+
+struct CoincidentKeyHash {
+	size_t operator()(const CoincidentKey& key) const {
+		size_t hash = (size_t) key.type;
+		auto add = [&hash](float value) {
+			value += 0.f;  // treat negative zero like zero; they compare equal
+			uint32_t bits;
+			std::memcpy(&bits, &value, sizeof(bits));
+			hash = hash * 31 + bits;
+		};
+		for (float value : { key.bounds.left, key.bounds.top, key.bounds.right, 
+				key.bounds.bottom, key.start.x, key.start.y, key.end.x, key.end.y })
+			add(value);
+		return hash;
+	}
+};
+
 OpSegments::OpSegments(OpContours& contours) {
 	inX.clear();
 	for (auto contour : contours.contours) {
@@ -28,6 +70,19 @@ OpSegments::OpSegments(OpContours& contours) {
 		}
 	}
 	std::sort(inX.begin(), inX.end(), compareXBox);
+	polygons = true;
+	for (const OpSegment* seg : inX) {
+		if (seg->disabled)
+			continue;
+		const PathOpsV0Lib::Curve& curve = seg->c.c;
+		const PathOpsV0Lib::CurveCallBacks& callBacks = contours.callBack(curve.type);
+		if (curve.type != contours.contextCallBacks.setLineTypeFuncPtr(curve)
+				|| callBacks.ptAtTFuncPtr || callBacks.axisTFuncPtr || callBacks.rotateFuncPtr
+				|| callBacks.curveIsFiniteFuncPtr) {
+			polygons = false;
+			break;
+		}
+	}
 	OP_DEBUG_CODE(debugFailSegID = 0);
 	OP_DEBUG_CODE(debugFailOppID = 0);
 
@@ -90,7 +145,7 @@ void OpSegments::AddEndMatches(OpSegment* seg, OpSegment* opp) {
 }
 
 // somewhat different from winder's edge based version, probably for no reason
-void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
+void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg, bool polygons) {
 	OP_DEBUG_CONTEXT();
 	OP_ASSERT(opp != seg);
 	OP_ASSERT(seg->c.debugIsLine());
@@ -99,7 +154,8 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
 	MatchReverse matchRev = opp->matchEnds(seg);
 	// if line and curve share end point, pass hint that root finder can call
 	// reduced form that assumes one root is zero or one.
-	OpRoots septs = opp->c.rayIntersect(edgePts, matchRev.match);
+	OpRoots septs = polygons ? opp->c.lineRayIntersect(edgePts, matchRev.match)
+			: opp->c.rayIntersect(edgePts, matchRev.match);
 #if 0  // code coverage did not detect any of these cases
 	if (septs.fail == RootFail::rawIntersectFailed) {
 		// binary search on opp t-range to find where vert crosses zero
@@ -124,7 +180,7 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
 	std::vector<OpPtT> edgePtTs;
 	size_t segSects = seg->sects.i.size();
 	size_t oppSects = opp->sects.i.size();
-	for (float oppT : septs.roots) {
+	for (float oppT : septs) {
 		if (OpMath::NearlyEndT(oppT))
 			continue;
 		// if computed point is nearly end, ignore
@@ -214,6 +270,7 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
 			OpWinder::CoincidentCheck(ends, nullptr, nullptr);
 		} else if (dist < seg->threshold().length() * 8) { // !!! who knows what this const should be?
 			int usectID = seg->nextID();
+			++seg->contour->contours->stats.unsectables;
 			seg->addUnsectable(iStart->ptT, usectID, endFromT(iStart, iEnd, MatchEnds::start), opp
 					OP_LINE_FILE_PARGS());
 			seg->addUnsectable(iEnd->ptT, usectID, endFromT(iStart, iEnd, MatchEnds::end), opp
@@ -234,10 +291,33 @@ void OpSegments::AddLineCurveIntersection(OpSegment* opp, OpSegment* seg) {
 
 void OpSegments::FindCoincidences(OpContours* contours) {
 	// take care of totally coincident segments
+	// segments with equal keys are chained in iteration order; only pairs in a chain can match
+	std::vector<OpSegment*> segs;
 	SegmentIterator segIterator(contours);
-	while (OpSegment* seg = segIterator.next()) {
-		SegmentIterator oppIterator = segIterator;
-		while (OpSegment* opp = oppIterator.next()) {
+	while (OpSegment* seg = segIterator.next())
+		segs.push_back(seg);
+	const size_t none = segs.size();
+	std::vector<size_t> nextMatch(segs.size(), none);
+	std::unordered_map<CoincidentKey, size_t, CoincidentKeyHash> lastMatch;
+	lastMatch.reserve(segs.size());
+	for (size_t index = 0; index < segs.size(); ++index) {
+		auto found = lastMatch.emplace(CoincidentKey(segs[index]), index);
+		if (!found.second) {
+			nextMatch[found.first->second] = index;
+			found.first->second = index;
+		}
+	}
+	for (size_t segIndex = 0; segIndex < segs.size(); ++segIndex) {
+		if (PathOpsV0Lib::ContextError::memory == contours->error)
+			return;  // storage exhausted; moving windings may allocate
+		OpSegment* seg = segs[segIndex];
+		if (seg->disabled)
+			continue;
+		for (size_t oppIndex = nextMatch[segIndex]; none != oppIndex; 
+				oppIndex = nextMatch[oppIndex]) {
+			OpSegment* opp = segs[oppIndex];
+			if (opp->disabled)
+				continue;
 			if (seg->ptBounds != opp->ptBounds)
 				continue;
 			MatchReverse mr = seg->matchEnds(opp);
@@ -254,7 +334,7 @@ void OpSegments::FindCoincidences(OpContours* contours) {
 	}
 }
 
-IntersectResult OpSegments::LineCoincidence(OpSegment* seg, OpSegment* opp) {
+IntersectResult OpSegments::LineCoincidence(OpSegment* seg, OpSegment* opp, bool polygons) {
 	OP_ASSERT(seg->c.debugIsLine());
 	OP_ASSERT(!seg->disabled);
 	// special case pairs that exactly match start and end
@@ -278,41 +358,236 @@ IntersectResult OpSegments::LineCoincidence(OpSegment* seg, OpSegment* opp) {
 			return IntersectResult::no;
 		return OpWinder::CoincidentCheck(seg, opp);
 	}
-	LinePts oppLine = opp->c.linePts();
-	OpCurve vertSeg = seg->c.toVertical(oppLine, ends.match);
-	if (!vertSeg.isFinite()) {
+	if (polygons)
+		return PolygonCoincidence(seg, opp, ends);
+	{
+		OpCurveScratch scratch(seg->contour->contours);  // rotated lines are freed on exit
+		LinePts oppLine = opp->c.linePts();
+		OpCurve vertSeg = seg->c.toVertical(oppLine, ends.match);
+		if (!vertSeg.isFinite()) {
+			seg->contour->contours->setError(PathOpsV0Lib::ContextError::toVertical  
+					OP_DEBUG_PARAMS(seg->id));
+			return IntersectResult::fail;
+		}
+		if (!vertSeg.isVertical())
+			return IntersectResult::no;
+		LinePts segLine = seg->c.linePts();
+		OpCurve vertOpp = opp->c.toVertical(segLine, ends.flipped());
+		if (!vertOpp.isFinite()) {
+			seg->contour->contours->setError(PathOpsV0Lib::ContextError::toVertical  
+					OP_DEBUG_PARAMS(opp->id));
+			return IntersectResult::fail;
+		}
+		if (!vertOpp.isVertical())
+			return IntersectResult::no;
+		if (fabsf(vertSeg.firstPt().x - vertOpp.firstPt().x) > OpEpsilon)
+			return IntersectResult::no;
+	}
+	return OpWinder::CoincidentCheck(seg, opp);
+}
+
+// same result as line coincidence's rotated lines, without allocating curve data
+IntersectResult OpSegments::PolygonCoincidence(OpSegment* seg, OpSegment* opp, 
+		MatchReverse ends) {
+	LinePts vertSeg = seg->c.lineToVertical(opp->c.linePts(), ends.match);
+	if (!vertSeg.pts[0].isFinite() || !vertSeg.pts[1].isFinite()) {
 		seg->contour->contours->setError(PathOpsV0Lib::ContextError::toVertical  
 				OP_DEBUG_PARAMS(seg->id));
 		return IntersectResult::fail;
 	}
-	if (!vertSeg.isVertical())
+	if (!OpCurve::IsVertical(vertSeg.pts[0], vertSeg.pts[1]))
 		return IntersectResult::no;
-	LinePts segLine = seg->c.linePts();
-	OpCurve vertOpp = opp->c.toVertical(segLine, ends.flipped());
-	if (!vertOpp.isFinite()) {
+	LinePts vertOpp = opp->c.lineToVertical(seg->c.linePts(), ends.flipped());
+	if (!vertOpp.pts[0].isFinite() || !vertOpp.pts[1].isFinite()) {
 		seg->contour->contours->setError(PathOpsV0Lib::ContextError::toVertical  
 				OP_DEBUG_PARAMS(opp->id));
 		return IntersectResult::fail;
 	}
-	if (!vertOpp.isVertical())
+	if (!OpCurve::IsVertical(vertOpp.pts[0], vertOpp.pts[1]))
 		return IntersectResult::no;
-	LinePts edgePts;
-	if (fabsf(vertSeg.firstPt().x - vertOpp.firstPt().x) > OpEpsilon)
+	if (fabsf(vertSeg.pts[0].x - vertOpp.pts[0].x) > OpEpsilon)
 		return IntersectResult::no;
 	return OpWinder::CoincidentCheck(seg, opp);
 }
 
+OpSweep::OpSweep(const std::vector<OpSegment*>& inX)
+	: maxOutset(0) {
+	size_t count = inX.size();
+	sortLeft.resize(count);
+	left.resize(count);
+	top.resize(count);
+	right.resize(count);
+	bottom.resize(count);
+	binTop.resize(count);
+	binBottom.resize(count);
+	float minY = OpInfinity;
+	float maxY = -OpInfinity;
+	for (size_t index = 0; index < count; ++index) {
+		const OpSegment* seg = inX[index];
+		sortLeft[index] = seg->ptBounds.left;
+		// intersecting may alias points, growing bounds; allow for that with an extra threshold
+		OpRect bounds = seg->closeBounds.isFinite() ? seg->closeBounds.outset(seg->threshold())
+				: OpRect(OpInfinity, OpInfinity, -OpInfinity, -OpInfinity);
+		left[index] = bounds.left;
+		top[index] = bounds.top;
+		right[index] = bounds.right;
+		bottom[index] = bounds.bottom;
+		if (bounds.top > bounds.bottom)
+			continue;
+		maxOutset = std::max(maxOutset, sortLeft[index] - bounds.left);
+		minY = std::min(minY, bounds.top);
+		maxY = std::max(maxY, bounds.bottom);
+	}
+	// about one bin per square root of count; fewer if tall segments would be listed too often
+	int binCount = std::max(1, std::min(4096, (int) sqrtf((float) count)));
+	float binHeight;
+	size_t entries;
+	auto bin = [minY, &binHeight, &binCount](float y) {
+		return std::max(0, std::min(binCount - 1, (int) ((y - minY) / binHeight)));
+	};
+	for (;;) {
+		binHeight = std::max((maxY - minY) / binCount, OpEpsilon);
+		entries = 0;
+		for (size_t index = 0; index < count; ++index) {
+			if (top[index] > bottom[index]) {
+				binTop[index] = 1;
+				binBottom[index] = 0;
+				continue;
+			}
+			binTop[index] = bin(top[index]);
+			binBottom[index] = bin(bottom[index]);
+			entries += binBottom[index] - binTop[index] + 1;
+		}
+		if (entries <= 8 * count || 1 == binCount)
+			break;
+		binCount = (binCount + 1) / 2;
+	}
+	binStart.assign(binCount + 1, 0);
+	for (size_t index = 0; index < count; ++index) {
+		for (int b = binTop[index]; b <= binBottom[index]; ++b)
+			++binStart[b + 1];
+	}
+	for (int b = 0; b < binCount; ++b)
+		binStart[b + 1] += binStart[b];
+	binEntries.resize(entries);
+	std::vector<uint32_t> fill(binStart.begin(), binStart.end() - 1);
+	for (size_t index = 0; index < count; ++index) {
+		for (int b = binTop[index]; b <= binBottom[index]; ++b)
+			binEntries[fill[b]++] = (uint32_t) index;
+	}
+}
+
+// returns segments after index in x order whose bounds are near those of index, in x order
+// a pair sharing more than one bin is found only in the first bin they share
+void OpSweep::candidates(uint32_t index, std::vector<uint32_t>& opps) const {
+	opps.clear();
+	for (int b = binTop[index]; b <= binBottom[index]; ++b) {
+		auto first = binEntries.begin() + binStart[b];
+		auto last = binEntries.begin() + binStart[b + 1];
+		for (auto entry = std::upper_bound(first, last, index); entry != last; ++entry) {
+			uint32_t opp = *entry;
+			if (sortLeft[opp] - maxOutset > right[index])
+				break;
+			if (std::max(binTop[index], binTop[opp]) != b)
+				continue;
+			if (left[opp] <= right[index] && top[opp] <= bottom[index] 
+					&& top[index] <= bottom[opp])
+				opps.push_back(opp);
+		}
+	}
+	if (binTop[index] < binBottom[index])
+		std::sort(opps.begin(), opps.end());
+}
+
+static void AddCurveCurveStats(const OpCurveCurve& cc, SectFound ccResult) {
+	PathOpsV0Lib::ContextStats& stats = cc.contours->stats;
+	static_assert((int) SectFound::split + 1 
+			== sizeof(PathOpsV0Lib::ContextStats::curveCurveResults) / sizeof(size_t));
+	++stats.curveCurvePairs;
+	++stats.curveCurveResults[(int) ccResult];
+	stats.curveCurveMaxDepth = std::max(stats.curveCurveMaxDepth, cc.depth);
+}
+
+// curve pair found by the sweep, intersected later when more than one thread is allowed
+struct CurveCurvePair {
+	OpSegment* seg;
+	OpSegment* opp;
+	std::unique_ptr<OpCurveCurve> cc;
+	SectFound ccResult;
+	SectFound limitsResult;
+};
+
+// Threads subdivide a batch of pairs; each thread allocates edges and curve data from its own
+// chains. Then the calling thread adds the batch's intersections to the segments in the order
+// the pairs were found, so the result does not depend on the thread count. The batch's edges
+// and curve data are then moved to the spare lists.
+static void IntersectCurvePairs(OpContours* contours, std::vector<CurveCurvePair>& pairs, 
+		unsigned threadCount) {
+	const size_t batchSize = 256;  // !!! arbitrary; limits the number of pairs held at once
+	const size_t threadPairs = 8;  // !!! arbitrary; fewer pairs per thread cost more to start
+	std::vector<OpThreadStorage> storage(threadCount);
+	for (size_t first = 0; first < pairs.size() && !contours->aborted(); first += batchSize) {
+		size_t last = std::min(first + batchSize, pairs.size());
+		std::atomic<size_t> nextIndex = first;
+		auto intersectNext = [&pairs, last, &nextIndex](OpThreadStorage* threadStorage) {
+			OpContours::threadStorage = threadStorage;
+			for (size_t index = nextIndex++; index < last; index = nextIndex++) {
+				CurveCurvePair& pair = pairs[index];
+				pair.cc.reset(new OpCurveCurve(pair.seg, pair.opp));
+				pair.ccResult = pair.cc->divideAndConquer();
+				pair.limitsResult = pair.cc->runsToLimits();
+			}
+			OpContours::threadStorage = nullptr;
+		};
+		std::vector<std::thread> threads;
+		for (unsigned index = 1; index < threadCount && index * threadPairs < last - first; 
+				++index)
+			threads.emplace_back(intersectNext, &storage[index]);
+		intersectNext(&storage[0]);  // calling thread is the first worker
+		for (std::thread& thread : threads)
+			thread.join();
+		for (size_t index = first; index < last; ++index) {
+			CurveCurvePair& pair = pairs[index];
+			AddCurveCurveStats(*pair.cc, pair.ccResult);
+			if (SectFound::add == pair.limitsResult)
+				pair.ccResult = pair.limitsResult;
+			if (SectFound::add == pair.ccResult || pair.cc->limits.size())
+				pair.cc->findUnsectable();
+			pair.cc.reset();
+		}
+		for (OpThreadStorage& threadStorage : storage) {
+			contours->reuse(threadStorage.ccStorage);
+			contours->rewind(threadStorage.curveDataStorage, nullptr, 0);
+		}
+	}
+	for (OpThreadStorage& threadStorage : storage)
+		contours->adoptStorage(threadStorage);
+}
+
 // note: ends have already been matched for consecutive segments
 FoundIntersections OpSegments::findIntersections() {
 	OP_DEBUG_CONTEXT();
-	for (auto segIter = inX.begin(); segIter != inX.end(); ++segIter) {
-		OpSegment* seg = const_cast<OpSegment*>(*segIter);
+	OpSweep sweep(inX);
+	std::vector<uint32_t> opps;
+	OpContours* contours = inX.size() ? inX[0]->contour->contours : nullptr;
+#if OP_DEBUG
+	unsigned threadCount = 1;  // debug state such as debugCurveCurve is shared by all pairs
+#else
+	unsigned threadCount = contours ? contours->threadCount : 1;
+#endif
+	std::vector<CurveCurvePair> ccPairs;
+	for (uint32_t segIndex = 0; segIndex < inX.size(); ++segIndex) {
+		if (PathOpsV0Lib::ContextError::memory == contours->error)
+			break;  // storage exhausted; the caller stops resolve
+		OpSegment* seg = const_cast<OpSegment*>(inX[segIndex]);
 		if (seg->disabled)
 			continue;
-		for (auto oppIter = segIter + 1; oppIter != inX.end(); ++oppIter) {
-			OpSegment* opp = const_cast<OpSegment*>(*oppIter);
+		sweep.candidates(segIndex, opps);
+		for (uint32_t oppIndex : opps) {
+			OpSegment* opp = const_cast<OpSegment*>(inX[oppIndex]);
 			if (opp->disabled)
 				continue;
+			++seg->contour->contours->stats.boundsPairs;
 			// comparisons below need to be 'nearly' since adjusting opp may make sort incorrect
 			// or, exact compare may miss nearly equal seg/opp pairs
 			if (seg->closeBounds.right < opp->closeBounds.left)
@@ -336,7 +611,7 @@ FoundIntersections OpSegments::findIntersections() {
 			// for line-curve intersection we can directly intersect
 			if (seg->c.isLine()) {
 				if (opp->c.isLine()) {
-					IntersectResult lineCoin = LineCoincidence(seg, opp);
+					IntersectResult lineCoin = LineCoincidence(seg, opp, polygons);
 					if (seg->disabled)
 						break;
 					if (IntersectResult::fail == lineCoin) {
@@ -347,10 +622,10 @@ FoundIntersections OpSegments::findIntersections() {
 					if (IntersectResult::coincident == lineCoin)
 						continue;
 				}
-				AddLineCurveIntersection(opp, seg);
+				AddLineCurveIntersection(opp, seg, polygons);
 				continue;
 			} else if (opp->c.isLine()) {
-				AddLineCurveIntersection(seg, opp);
+				AddLineCurveIntersection(seg, opp, polygons);
 				continue;
 			}
 			// if the bounds only share a corner, there's nothing more to do
@@ -361,8 +636,14 @@ FoundIntersections OpSegments::findIntersections() {
 			if (sharesHorizontal && sharesVertical)
 				continue;
 			// look for curve curve intersections (skip coincidence already found)
+			if (1 < threadCount) {
+				ccPairs.push_back({ seg, opp, nullptr, SectFound::no, SectFound::no });
+				continue;
+			}
+			OpCurveScratch scratch(contours);  // edge curves are freed after the pair
 			OpCurveCurve cc(seg, opp);
 			SectFound ccResult = cc.divideAndConquer();
+			AddCurveCurveStats(cc, ccResult);
 			OP_ASSERT(cc.debugShowImage());
 			if (true) { // SectFound::fail == ccResult || SectFound::maxOverlaps == ccResult
 						//        || SectFound::noOverlapDeep == ccResult
@@ -374,9 +655,17 @@ FoundIntersections OpSegments::findIntersections() {
 			if (SectFound::add == ccResult || cc.limits.size())
 				cc.findUnsectable();
 			OP_DEBUG_CONTEXT();
+			contours->reuse(contours->ccStorage);  // edges are scratch once sects are added
 		}
-		if (!seg->sects.i.size())
+		if (1 == threadCount && !seg->sects.i.size())
 			seg->disabled = true;
 	}
+	if (1 < threadCount) {
+		IntersectCurvePairs(contours, ccPairs, threadCount);
+		for (OpSegment* seg : inX) {
+			if (!seg->sects.i.size())
+				seg->disabled = true;
+		}
+	}
 	return FoundIntersections::yes; // !!! if something can fail, return 'fail' (don't return 'no')
 }
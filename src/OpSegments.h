@@ -9,23 +9,44 @@ struct OpSegment;
 enum class FoundIntersections;
 enum class IntersectResult;
 
+// finds segment pairs whose bounds are near each other for find intersections
+// bounds are copied into arrays ordered like the segments, which are sorted by left edge
+// bins divide the vertical range; each segment is listed in every bin its bounds cover
+struct OpSweep {
+	OpSweep(const std::vector<OpSegment*>& inX);
+	void candidates(uint32_t index, std::vector<uint32_t>& opps) const;
+
+	std::vector<float> sortLeft;  // segment ptBounds left; ascending
+	std::vector<float> left;  // segment closeBounds, outset for points moved while intersecting
+	std::vector<float> top;
+	std::vector<float> right;
+	std::vector<float> bottom;
+	std::vector<int> binTop;  // first and last bin covered by each segment; empty if top > bottom
+	std::vector<int> binBottom;
+	std::vector<uint32_t> binStart;  // offset of each bin's first entry in bin entries
+	std::vector<uint32_t> binEntries;  // segment indices, ascending within each bin
+	float maxOutset;  // largest difference between sort left and left
+};
+
 struct OpSegments {
 	OpSegments(OpContours& contours);
 	static void AddEndMatches(OpSegment* seg, OpSegment* opp);
-	static void AddLineCurveIntersection(OpSegment* opp, OpSegment* seg);
+	static void AddLineCurveIntersection(OpSegment* opp, OpSegment* seg, bool polygons);
 	void findCoincidences();
 	static void FindCoincidences(OpContours* );  // new interface
 //    void findLineCoincidences();
 	FoundIntersections findIntersections();
 //    FoundIntersections findIntersectionsX();
 //    static FoundIntersections FindIntersections(OpContours* );  // new interface
-	static IntersectResult LineCoincidence(OpSegment* seg, OpSegment* opp);
+	static IntersectResult LineCoincidence(OpSegment* seg, OpSegment* opp, bool polygons);
+	static IntersectResult PolygonCoincidence(OpSegment* seg, OpSegment* opp, MatchReverse );
 
 #if OP_DEBUG_DUMP
 	#include "OpDebugDeclarations.h"
 #endif
 
 	std::vector<OpSegment*> inX;
+	bool polygons;  // every segment is a line with no geometry callbacks; lines meet directly
 	OP_DEBUG_CODE(int debugFailSegID);
 	OP_DEBUG_CODE(int debugFailOppID);
 };
@@ -206,6 +206,81 @@ void SectRay::sort() {
 	});
 }
 
+int OpRayBins::bin(float normal) const {
+	float b = (normal - binMin) / binSize;
+	if (!(b > 0))
+		return 0;
+	return b < binCount - 1 ? (int) b : binCount - 1;
+}
+
+// edges whose bounds are not finite are listed in every bin, since the ray may not reject them
+void OpRayBins::set(const std::vector<OpEdge*>& inArray, Axis axis) {
+	size_t count = inArray.size();
+	binCount = 0;
+	if (count < 32)  // walking every edge is as fast as walking a bin
+		return;
+	float minCept = OpInfinity;
+	float maxCept = -OpInfinity;
+	for (const OpEdge* edge : inArray) {
+		float lo = edge->ptBounds.ltChoice(axis);
+		float hi = edge->ptBounds.rbChoice(axis);
+		if (!OpMath::IsFinite(lo) || !OpMath::IsFinite(hi) || lo > hi)
+			continue;
+		minCept = std::min(minCept, lo);
+		maxCept = std::max(maxCept, hi);
+	}
+	if (minCept > maxCept)
+		return;
+	binMin = minCept;
+	// about one bin per edge; fewer if long edges would be listed too often
+	binCount = (int) std::min(count, (size_t) 1 << 16);
+	std::vector<int> binLo(count);
+	std::vector<int> binHi(count);
+	size_t entries;
+	for (;;) {
+		binSize = std::max((maxCept - minCept) / binCount, OpEpsilon);
+		entries = 0;
+		for (size_t index = 0; index < count; ++index) {
+			const OpEdge* edge = inArray[index];
+			float lo = edge->ptBounds.ltChoice(axis);
+			float hi = edge->ptBounds.rbChoice(axis);
+			bool finite = OpMath::IsFinite(lo) && OpMath::IsFinite(hi) && lo <= hi;
+			binLo[index] = finite ? bin(lo) : 0;
+			binHi[index] = finite ? bin(hi) : binCount - 1;
+			entries += binHi[index] - binLo[index] + 1;
+		}
+		if (entries <= 8 * count || 1 == binCount)
+			break;
+		binCount = (binCount + 1) / 2;
+	}
+	binStart.assign(binCount + 1, 0);
+	for (size_t index = 0; index < count; ++index) {
+		for (int b = binLo[index]; b <= binHi[index]; ++b)
+			++binStart[b + 1];
+	}
+	for (int b = 0; b < binCount; ++b)
+		binStart[b + 1] += binStart[b];
+	binEntries.resize(entries);
+	std::vector<uint32_t> fill(binStart.begin(), binStart.end() - 1);
+	for (size_t index = 0; index < count; ++index) {
+		for (int b = binLo[index]; b <= binHi[index]; ++b)
+			binEntries[fill[b]++] = (uint32_t) index;
+	}
+}
+
+// the walk starts at the edge before in index; a ray with no normal may cross any edge
+OpRayWalk::OpRayWalk(const OpRayBins& bins, float normal, size_t inIndex)
+	: first(nullptr)
+	, entry(nullptr)
+	, end(inIndex) {
+	if (!bins.binCount || OpMath::IsNaN(normal))
+		return;
+	int b = bins.bin(normal);
+	first = bins.binEntries.data() + bins.binStart[b];
+	entry = std::lower_bound(first, bins.binEntries.data() + bins.binStart[b + 1], 
+			(uint32_t) inIndex);
+}
+
 OpWinder::OpWinder(OpContours& contours) {
 	for (auto contour : contours.contours) {
 		for (auto& segment : contour->segments) {
@@ -215,6 +290,8 @@ OpWinder::OpWinder(OpContours& contours) {
 		}
 	}
 	sort();
+	xBins.set(inX, Axis::horizontal);
+	yBins.set(inY, Axis::vertical);
 	workingAxis = Axis::neither;
 }
 
@@ -473,6 +550,7 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 	float mid = .5;
 	float midEnd = .5;
 	std::vector<OpEdge*>& inArray = Axis::horizontal == workingAxis ? inX : inY;
+	const OpRayBins& bins = Axis::horizontal == workingAxis ? xBins : yBins;
 	ray.homeT = OpMath::Ratio(home->startT, home->endT, home->center.t);
 	// if find intercept fails, retry some number of times
 	// if all retries fail, distinguish between failure cases
@@ -482,9 +560,11 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 		ray.distances.clear();
 		ray.distances.emplace_back(home, homeCept, ray.homeT, false);
 		size_t inIndex = setInIndex(homeIndex, homeCept, inArray);
-		// start at edge with left equal to or left of center
-		while (inIndex != 0) {
-			OpEdge* test = inArray[--inIndex];
+		// start at edge with left equal to or left of center; skip edges the ray cannot cross
+		OpRayWalk walk(bins, normal, inIndex);
+		while (walk.next(&inIndex)) {
+			OpEdge* test = inArray[inIndex];
+			++home->contours()->stats.rayEdges;
 			FindCept findCept = ray.findIntercept(home, test);
 			if (FindCept::ok == findCept)
 				continue;
@@ -518,6 +598,7 @@ FoundIntercept OpWinder::findRayIntercept(size_t homeIndex, OpVector homeTan, fl
 			break;	// give up
 		}
 		// if find ray intercept can't find, restart with new center, normal, distance, etc.
+		++home->contours()->stats.rayRetries;
 		ray.homeCept = homeCept = home->curve.ptAtT(homeMidT).choice(perpendicular);
 		OP_ASSERT(!OpMath::IsNaN(homeCept));
 		ray.normal = normal = home->curve.ptAtT(homeMidT).choice(workingAxis);
@@ -539,13 +620,12 @@ void OpWinder::markUnsortable(Unsortable unsortable) {
 size_t OpWinder::setInIndex(size_t homeIndex, float homeCept, std::vector<OpEdge*>& inArray) {
 	Axis perpendicular = !workingAxis;
 	// advance to furthest that could influence the sum winding of this edge
-	size_t inIndex = homeIndex + 1;
-	for (; inIndex < inArray.size(); ++inIndex) {
-		OpEdge* advance = inArray[inIndex];
-		if (advance->ptBounds.ltChoice(perpendicular) > homeCept)
-			break;
-	}
-	return inIndex;
+	// edges are sorted by the perpendicular axis, so the first past home cept is found by halves
+	auto found = std::partition_point(inArray.begin() + homeIndex + 1, inArray.end(),
+			[perpendicular, homeCept](const OpEdge* advance) {
+		return !(advance->ptBounds.ltChoice(perpendicular) > homeCept);
+	});
+	return (size_t) (found - inArray.begin());
 }
 
 // if horizontal axis, look at rect top/bottom
@@ -653,7 +733,7 @@ ResolveWinding OpWinder::setWindingByDistance(OpContours* contours) {
 		EdgePal& sumDistance = ray.distances[sumIndex];
 		OpEdge* sumEdge = sumDistance.edge;
 		OP_ASSERT(!sumEdge->isUnsectable());
-		sumWinding.w = sumEdge->sum.copyData();
+		sumWinding.setData(sumEdge->sum.w);
 		OP_DEBUG_CODE(sumWinding.debugType = WindingType::temp);
 		// if pointing down/left, subtract winding
 		if (CalcFail::fail == sumEdge->subIfDL(ray.axis, sumDistance.edgeInsideT, &sumWinding))  
@@ -719,6 +799,8 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 				continue;
 	//		if (home->between)	// !!! set sum chain even if ray cannot be used for this edge...?
 	//			continue;
+			if (contours->aborted())
+				return FoundWindings::fail;
 			if (EdgeFail::horizontal == home->rayFail && Axis::vertical == workingAxis)
 				home->rayFail = EdgeFail::none;
 			else if (Unsortable::none != home->isUnsortable)  // may be too small
@@ -804,6 +886,8 @@ FoundWindings OpWinder::setWindings(OpContours* contours) {
 	for (auto edge : bySize) {
 		if (edge->sum.isSet())
 			continue;
+		if (contours->aborted())
+			return FoundWindings::fail;
 		home = edge;
 		ResolveWinding resolveWinding = setWindingByDistance(contours);
 		if (ResolveWinding::retry == resolveWinding) {
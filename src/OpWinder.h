@@ -54,6 +54,49 @@ struct CoinEnd {
 	OpVector oppT;
 };
 
+// finds edges that a winding ray may cross, for find ray intercept
+// bins divide the range of ray normals; each edge in the axis array (inX or inY) is listed in every
+// bin its bounds cover along the working axis, so a ray visits only edges whose bounds contain it
+struct OpRayBins {
+	OpRayBins()
+		: binMin(0)
+		, binSize(0)
+		, binCount(0) {
+	}
+
+	int bin(float normal) const;
+	void set(const std::vector<OpEdge*>& inArray, Axis );
+
+	std::vector<uint32_t> binStart;  // offset of each bin's first entry in bin entries
+	std::vector<uint32_t> binEntries;  // edge indices, ascending within each bin
+	float binMin;
+	float binSize;
+	int binCount;  // zero if there are too few edges to bin
+};
+
+// walks edge indices in the axis array from the ray's end toward its start
+// visits only a bin's entries if the axis array is binned, otherwise visits every index
+struct OpRayWalk {
+	OpRayWalk(const OpRayBins& , float normal, size_t inIndex);
+
+	bool next(size_t* index) {
+		if (first) {
+			if (entry == first)
+				return false;
+			*index = *--entry;
+			return true;
+		}
+		if (!end)
+			return false;
+		*index = --end;
+		return true;
+	}
+
+	const uint32_t* first;
+	const uint32_t* entry;
+	size_t end;
+};
+
 struct OpWinder {
 	OpWinder(OpContours& contours);
 	void addEdge(OpEdge* );
@@ -81,6 +124,8 @@ struct OpWinder {
 
 	std::vector<OpEdge*> inX;
 	std::vector<OpEdge*> inY;
+	OpRayBins xBins;  // inX edges, binned by vertical extent for horizontal rays
+	OpRayBins yBins;
 	OpEdge* home;
 	Axis workingAxis;
 	float interceptLimit;
@@ -1,35 +1,111 @@
 // (c) 2024, Cary Clark cclark2@gmail.com
 #include "OpContour.h"
 #include "OpWinding.h"
+#include "OpWindingSet.h"
+
+OpBuiltInWinding OpBuiltInWinding::Find(const PathOpsV0Lib::WindingCallBacks& callBacks) {
+	OpBuiltInWinding result;
+	for (const OpWindingCombineFuncs& funcs : OpWindingCombines) {
+		if (funcs.windingAddFuncPtr == callBacks.windingAddFuncPtr
+				&& funcs.windingSubtractFuncPtr == callBacks.windingSubtractFuncPtr)
+			result.combine = funcs.combine;
+	}
+	for (const OpWindingKeepFuncs& funcs : OpWindingKeeps) {
+		if (funcs.windingKeepFuncPtr == callBacks.windingKeepFuncPtr
+				&& funcs.windingVisibleFuncPtr == callBacks.windingVisibleFuncPtr
+				&& funcs.windingZeroFuncPtr == callBacks.windingZeroFuncPtr)
+			result.keep = funcs.keep;
+	}
+	// counts are read inline only if all callbacks are built in and agree on the operand count
+	if (BuiltInWinding::none == result.combine || BuiltInKeep::none == result.keep
+			|| OpIsUnary(result.combine) != OpIsUnary(result.keep))
+		return OpBuiltInWinding();
+	return result;
+}
 
 OpWinding::OpWinding(OpContour* c, PathOpsV0Lib::Winding copy)
 	: contour(c)
 	OP_DEBUG_PARAMS(debugType(WindingType::copy)) {
-	w.data = contour->contours->allocateWinding(copy.size);
+	allocate(copy.size);
 	std::memcpy(w.data, copy.data, copy.size);
-	w.size = copy.size;
 }
 
 OpWinding::OpWinding(OpEdge* edge, WindingSum )
 	: contour(edge->segment->contour)
 	OP_DEBUG_PARAMS(debugType(WindingType::sum)) {
-	w = edge->winding.copyData();
+	w.data = nullptr;
+	setData(edge->winding.w);
 	zero();
 }
 
 OpWinding& OpWinding::operator=(const OpWinding& from) {
 	contour = from.contour;
-	w = from.copyData();
+	setData(from.w);
 	return *this;
 }
 
 OpWinding::OpWinding(const OpWinding& from) {
 	contour = from.contour;
-	w = from.copyData();
+	w.data = nullptr;
+	setData(from.w);
 }
 
 void OpWinding::add(const OpWinding& winding) {
-	contour->callBacks.windingAddFuncPtr(w, winding.w);
+	combine(winding, false);
+}
+
+// windings that fit are stored in the winding, so copies of edges and sums do not grow the
+// caller data storage; larger caller-defined windings are allocated from the context
+void OpWinding::allocate(size_t size) {
+	w.size = size;
+	w.data = size <= sizeof(inlineData) ? (PathOpsV0Lib::WindingData) inlineData
+			: contour->contours->allocateWinding(size);
+}
+
+// built-in windings are summed in place: each operand count either winds or toggles
+void OpWinding::combine(const OpWinding& operand, bool subtract) {
+	BuiltInWinding builtIn = contour->builtIn.combine;
+	if (BuiltInWinding::none == builtIn) {
+		if (subtract)
+			contour->callBacks.windingSubtractFuncPtr(w, operand.w);
+		else
+			contour->callBacks.windingAddFuncPtr(w, operand.w);
+		return;
+	}
+	OP_ASSERT(w.data == inlineData && operand.w.data == operand.inlineData);
+	const int* opCounts = operand.inlineData;
+	auto wind = [subtract](int& count, int opCount) {
+		count = subtract ? count - opCount : count + opCount;
+	};
+	auto evenOdd = [](int& count, int opCount) {
+		count ^= opCount;
+	};
+	switch (builtIn) {
+		case BuiltInWinding::unaryWinding:
+			wind(inlineData[0], opCounts[0]);
+			break;
+		case BuiltInWinding::unaryEvenOdd:
+			evenOdd(inlineData[0], opCounts[0]);
+			break;
+		case BuiltInWinding::binaryWinding:
+			wind(inlineData[0], opCounts[0]);
+			wind(inlineData[1], opCounts[1]);
+			break;
+		case BuiltInWinding::binaryEvenOdd:
+			evenOdd(inlineData[0], opCounts[0]);
+			evenOdd(inlineData[1], opCounts[1]);
+			break;
+		case BuiltInWinding::binaryWindLeft:
+			wind(inlineData[0], opCounts[0]);
+			evenOdd(inlineData[1], opCounts[1]);
+			break;
+		case BuiltInWinding::binaryWindRight:
+			evenOdd(inlineData[0], opCounts[0]);
+			wind(inlineData[1], opCounts[1]);
+			break;
+		default:
+			OP_ASSERT(0);
+	}
 }
 
 #if 0
@@ -39,28 +115,63 @@ bool OpWinding::equal(PathOpsV0Lib::Winding comp) const {
 }
 #endif
 
-PathOpsV0Lib::Winding OpWinding::copyData() const {
-	OpContours* contours = contour->contours;
-	PathOpsV0Lib::Winding copy { contours->allocateWinding(w.size), w.size };
-	std::memcpy(copy.data, w.data, w.size);
-	return copy;
+// winding is the edge's winding; sumWinding is the sum on the side the edge normal points to
+PathOpsV0Lib::WindKeep OpWinding::keep(const OpWinding& sumWinding) const {
+	BuiltInKeep builtIn = contour->builtIn.keep;
+	if (BuiltInKeep::none == builtIn)
+		return contour->callBacks.windingKeepFuncPtr(w, sumWinding.w);
+	OP_ASSERT(w.data == inlineData && sumWinding.w.data == sumWinding.inlineData);
+	const int* sums = sumWinding.inlineData;
+	if (BuiltInKeep::unary == builtIn)
+		return PathOpsV0Lib::unaryWindingKeep(PathOpsV0Lib::UnaryWinding(inlineData[0]),
+				PathOpsV0Lib::UnaryWinding(sums[0]));
+	PathOpsV0Lib::KeepData data(PathOpsV0Lib::BinaryWinding(inlineData[0], inlineData[1]),
+			PathOpsV0Lib::BinaryWinding(sums[0], sums[1]));
+	if (!data.flips)
+		return data.keep;
+	switch (builtIn) {
+		case BuiltInKeep::binaryDifference: data.Difference(); break;
+		case BuiltInKeep::binaryExclusiveOr: data.ExclusiveOr(); break;
+		case BuiltInKeep::binaryIntersect: data.Intersect(); break;
+		case BuiltInKeep::binaryReverseDifference: data.ReverseDifference(); break;
+		case BuiltInKeep::binaryUnion: data.Union(); break;
+		default: OP_ASSERT(0);
+	}
+	return data.keep;
+}
+
+// keeps the current data if it is the same size
+void OpWinding::setData(PathOpsV0Lib::Winding from) {
+	if (!w.data || w.size != from.size)
+		allocate(from.size);
+	if (w.data != from.data)
+		std::memcpy(w.data, from.data, from.size);
 }
 
 void OpWinding::subtract(const OpWinding& winding) {
-	contour->callBacks.windingSubtractFuncPtr(w, winding.w);
+	combine(winding, true);
 }
 
 bool OpWinding::visible() const {
-	return contour->callBacks.windingVisibleFuncPtr(w);
+	BuiltInWinding builtIn = contour->builtIn.combine;
+	if (BuiltInWinding::none == builtIn)
+		return contour->callBacks.windingVisibleFuncPtr(w);
+	OP_ASSERT(w.data == inlineData);
+	return inlineData[0] || (!OpIsUnary(builtIn) && inlineData[1]);
 }
 
 void OpWinding::zero() {
-	contour->callBacks.windingZeroFuncPtr(w);
+	BuiltInWinding builtIn = contour->builtIn.combine;
+	if (BuiltInWinding::none == builtIn) {
+		contour->callBacks.windingZeroFuncPtr(w);
+		return;
+	}
+	OP_ASSERT(w.data == inlineData);
+	inlineData[0] = 0;
+	if (!OpIsUnary(builtIn))
+		inlineData[1] = 0;
 }
 
 void OpWinding::move(const OpWinding& opp, bool backwards) {
-	if (backwards)
-		contour->callBacks.windingSubtractFuncPtr(w, opp.w);
-	else
-		contour->callBacks.windingAddFuncPtr(w, opp.w);
+	combine(opp, backwards);
 }
@@ -20,6 +20,41 @@ enum class WindingTemp {	// used to accumulate winding sum before it is applied
 	dummy
 };
 
+// windings whose callbacks match a winding in curves/; see OpWindingSet.h
+// counts are stored inline, one int per operand
+enum class BuiltInWinding : int8_t {
+	none,  // call through callbacks registered with contour
+	unaryWinding,
+	unaryEvenOdd,
+	binaryWinding,
+	binaryEvenOdd,
+	binaryWindLeft,  // left operand winds, right operand is even odd
+	binaryWindRight  // left operand is even odd, right operand winds
+};
+
+enum class BuiltInKeep : int8_t {
+	none,  // call through callback registered with contour
+	unary,
+	binaryDifference,
+	binaryExclusiveOr,
+	binaryIntersect,
+	binaryReverseDifference,
+	binaryUnion
+};
+
+// set by SetWindingCallBacks; both are none unless all winding callbacks are built in
+struct OpBuiltInWinding {
+	OpBuiltInWinding()
+		: combine(BuiltInWinding::none)
+		, keep(BuiltInKeep::none) {
+	}
+
+	static OpBuiltInWinding Find(const PathOpsV0Lib::WindingCallBacks& );
+
+	BuiltInWinding combine;  // add, subtract, visible, zero
+	BuiltInKeep keep;
+};
+
 enum class WindingType  {
 	uninitialized = -1,
 	temp,
@@ -43,19 +78,22 @@ struct OpWinding {
 	OpWinding(const OpWinding&);
 
 	void add(const OpWinding& );
+	void allocate(size_t );
+	void combine(const OpWinding& , bool subtract);
 	bool equal(const PathOpsV0Lib::Winding ) const;
-	PathOpsV0Lib::Winding copyData() const;
 
 	bool isSet() const {
 		return !!contour;
 	}
 
+	PathOpsV0Lib::WindKeep keep(const OpWinding& sumWinding) const;
 	void subtract(const OpWinding& );
 	void move(const OpWinding& opp, bool backwards);
+	void setData(PathOpsV0Lib::Winding );
 
 	void setWind(const OpWinding& fromSegment) {
 		contour = fromSegment.contour;
-		w = fromSegment.copyData();
+		setData(fromSegment.w);
 		OP_DEBUG_CODE(debugType = WindingType::winding);
 	}
 
@@ -69,7 +107,8 @@ struct OpWinding {
 #endif
 
 	OpContour* contour;
-	PathOpsV0Lib::Winding w;
+	PathOpsV0Lib::Winding w;  // data points to inlineData, or to caller data if it does not fit
+	alignas(void*) int inlineData[4];  // large enough for unary and binary windings
 	OP_DEBUG_CODE(WindingType debugType);
 };
 
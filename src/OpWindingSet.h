@@ -0,0 +1,73 @@
+// (c) 2024, Cary Clark cclark2@gmail.com
+#ifndef OpWindingSet_DEFINED
+#define OpWindingSet_DEFINED
+
+// The windings in curves/UnaryWinding.h and curves/BinaryWinding.h are known when the engine is
+// compiled. A contour registered with exactly the callbacks of one of them is summed and kept by
+// OpWinding on its inline counts: there is no copy in and out of the winding data, and no call
+// through a function pointer. Contours with other callbacks use the callbacks they registered.
+// BinaryWinding.h has no include guard; include this only where it is not included.
+
+#include "curves/UnaryWinding.h"
+#include "curves/BinaryWinding.h"
+#include <cstddef>
+
+static_assert(sizeof(PathOpsV0Lib::UnaryWinding) == sizeof(int));
+static_assert(sizeof(PathOpsV0Lib::BinaryWinding) == 2 * sizeof(int));
+static_assert(offsetof(PathOpsV0Lib::BinaryWinding, right) == sizeof(int));
+
+// add and subtract pairs, as registered by SetSkiaSimplifyCallBacks, SetSkiaOpCallBacks, and
+// the Path2D interface; even odd windings register add as subtract, or leave subtract unset
+struct OpWindingCombineFuncs {
+	PathOpsV0Lib::WindingAdd windingAddFuncPtr;
+	PathOpsV0Lib::WindingSubtract windingSubtractFuncPtr;
+	BuiltInWinding combine;
+};
+
+constexpr OpWindingCombineFuncs OpWindingCombines[] = {
+	{ PathOpsV0Lib::unaryWindingAddFunc, PathOpsV0Lib::unaryWindingSubtractFunc,
+			BuiltInWinding::unaryWinding },
+	{ PathOpsV0Lib::unaryEvenOddFunc, PathOpsV0Lib::unaryEvenOddFunc,
+			BuiltInWinding::unaryEvenOdd },
+	{ PathOpsV0Lib::binaryWindingAddFunc, PathOpsV0Lib::binaryWindingSubtractFunc,
+			BuiltInWinding::binaryWinding },
+	{ PathOpsV0Lib::binaryEvenOddFunc, PathOpsV0Lib::binaryEvenOddFunc,
+			BuiltInWinding::binaryEvenOdd },
+	{ PathOpsV0Lib::binaryWindingAddLeftFunc, PathOpsV0Lib::binaryWindingSubtractLeftFunc,
+			BuiltInWinding::binaryWindLeft },
+	{ PathOpsV0Lib::binaryWindingAddRightFunc, PathOpsV0Lib::binaryWindingSubtractRightFunc,
+			BuiltInWinding::binaryWindRight },
+};
+
+// keep callbacks, with the visible and zero callbacks for the same winding size
+struct OpWindingKeepFuncs {
+	PathOpsV0Lib::WindingKeep windingKeepFuncPtr;
+	PathOpsV0Lib::WindingVisible windingVisibleFuncPtr;
+	PathOpsV0Lib::WindingZero windingZeroFuncPtr;
+	BuiltInKeep keep;
+};
+
+constexpr OpWindingKeepFuncs OpWindingKeeps[] = {
+	{ PathOpsV0Lib::unaryWindingKeepFunc, PathOpsV0Lib::unaryWindingVisibleFunc,
+			PathOpsV0Lib::unaryWindingZeroFunc, BuiltInKeep::unary },
+	{ PathOpsV0Lib::binaryWindingDifferenceFunc, PathOpsV0Lib::binaryWindingVisibleFunc,
+			PathOpsV0Lib::binaryWindingZeroFunc, BuiltInKeep::binaryDifference },
+	{ PathOpsV0Lib::binaryWindingExclusiveOrFunc, PathOpsV0Lib::binaryWindingVisibleFunc,
+			PathOpsV0Lib::binaryWindingZeroFunc, BuiltInKeep::binaryExclusiveOr },
+	{ PathOpsV0Lib::binaryWindingIntersectFunc, PathOpsV0Lib::binaryWindingVisibleFunc,
+			PathOpsV0Lib::binaryWindingZeroFunc, BuiltInKeep::binaryIntersect },
+	{ PathOpsV0Lib::binaryWindingReverseDifferenceFunc, PathOpsV0Lib::binaryWindingVisibleFunc,
+			PathOpsV0Lib::binaryWindingZeroFunc, BuiltInKeep::binaryReverseDifference },
+	{ PathOpsV0Lib::binaryWindingUnionFunc, PathOpsV0Lib::binaryWindingVisibleFunc,
+			PathOpsV0Lib::binaryWindingZeroFunc, BuiltInKeep::binaryUnion },
+};
+
+inline bool OpIsUnary(BuiltInWinding combine) {
+	return BuiltInWinding::unaryWinding == combine || BuiltInWinding::unaryEvenOdd == combine;
+}
+
+inline bool OpIsUnary(BuiltInKeep keep) {
+	return BuiltInKeep::unary == keep;
+}
+
+#endif
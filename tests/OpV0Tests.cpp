@@ -6781,7 +6781,36 @@ path.close();
     testSimplify(reporter, path, filename);
 }
 
+// the far circle in the right operand of a difference touches nothing and is discarded
+static void discardDisjoint1(skiatest::Reporter* reporter, const char* filename) {
+    SkPath left, right, far;
+    left.addRect(0, 0, 20, 20);
+    right.addRect(10, 10, 30, 30);
+    far.addCircle(80, 80, 10);
+    testPathOpDisjoint(reporter, left, right, far, kDifference_SkPathOp, filename);
+}
+
+// the far rect in an intersect operand touches nothing and is discarded
+static void discardDisjoint2(skiatest::Reporter* reporter, const char* filename) {
+    SkPath left, right, far;
+    left.addCircle(15, 15, 12);
+    right.addRect(10, 10, 30, 30);
+    far.addRect(60, 0, 80, 20);
+    testPathOpDisjoint(reporter, left, right, far, kIntersect_SkPathOp, filename);
+}
+
+// intersect operands that touch nothing are both discarded, leaving no output
+static void discardDisjoint3(skiatest::Reporter* reporter, const char* filename) {
+    SkPath left, right, far;
+    left.addCircle(15, 15, 12);
+    far.addRect(60, 0, 80, 20);
+    testPathOpDisjoint(reporter, left, right, far, kIntersect_SkPathOp, filename);
+}
+
 static struct TestDesc tests[] = {
+    TEST(discardDisjoint3),
+    TEST(discardDisjoint2),
+    TEST(discardDisjoint1),
     TEST(testQuads23839519),
     TEST(skiaIssue377820800),
     TEST(cubic1554993),
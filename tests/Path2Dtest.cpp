@@ -0,0 +1 @@
+Path2DTest.cpp
\ No newline at end of file
@@ -98,6 +98,8 @@ bool testPathOp(skiatest::Reporter*, const SkPath& a, const SkPath& b,
         SkPathOp op, const char* filename);
 bool testPathOpBase(skiatest::Reporter* , const SkPath& a, const SkPath& b, 
         SkPathOp op, const char* filename, bool v0MayFail, bool skiaMayFail);
+void testPathOpDisjoint(skiatest::Reporter*, const SkPath& a, const SkPath& b, 
+        const SkPath& disjoint, SkPathOp op, const char* filename);
 void testPathOpCheck(skiatest::Reporter*, const SkPath& a, const SkPath& b, SkPathOp op, 
         const char* filename, bool checkFail);
 void testPathOpFuzz(skiatest::Reporter*, const SkPath& a, const SkPath& b, SkPathOp op, 
@@ -4,6 +4,7 @@
 #include "curves/NoCurve.h"
 #include "curves/QuadBezier.h"
 #include "curves/UnaryWinding.h"
+#include <cstddef>
 
 // curve types
 PathOpsV0Lib::CurveType lineType = (PathOpsV0Lib::CurveType) 0;  // unset
@@ -42,6 +43,128 @@ PathOpsV0Lib::CurveType testNewSetLineType(PathOpsV0Lib::Curve ) {
     return lineType;
 }
 
+// bump allocator over a fixed buffer; nothing is returned to the buffer until it is discarded
+struct TestArena {
+    char* buffer;
+    size_t size;
+    size_t used;
+    int allocated;
+    int freed;
+    int limit;  // most blocks handed out; zero if unlimited
+};
+
+void* testArenaAllocate(size_t size, void* data) {
+    TestArena* arena = (TestArena*) data;
+    size_t start = (arena->used + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1);
+    if (start + size > arena->size || (arena->limit && arena->allocated >= arena->limit))
+        return nullptr;
+    arena->used = start + size;
+    ++arena->allocated;
+    return arena->buffer + start;
+}
+
+void testArenaFree(void* , void* data) {
+    ++((TestArena*) data)->freed;
+}
+
+// runs the quad and line loops below with storage from a fixed buffer
+PathOpsV0Lib::ContextError testArenaResolve(TestArena& arena, size_t budget = 0, 
+        size_t* peak = nullptr, PathOpsV0Lib::Cancel cancel = nullptr) {
+    using namespace PathOpsV0Lib;
+    Context* context = CreateContext({ testArenaAllocate, testArenaFree, &arena });
+    SetMemoryBudget(context, budget);
+    SetContextCallBacks(context, { testNewSetLineType, nullptr, nullptr, nullptr, nullptr, nullptr,
+            cancel });
+    lineType = SetCurveCallBacks(context, { lineOutput });
+    quadType = SetCurveCallBacks(context, { quadOutput, quadAxisT,
+			quadHull, quadIsFinite, quadIsLine, 
+			quadSetBounds, quadPinCtrl, 
+			quadTangent, quadsEqual, quadPtAtT,
+            quadHullPtCount, quadRotate, quadSubDivide, quadXYAtT });
+    UnaryWinding windingData(1);
+    Contour* contour = CreateContour(context, { &windingData, sizeof(windingData) });
+    SetWindingCallBacks(contour, { unaryWindingAddFunc, unaryWindingKeepFunc, unaryWindingVisibleFunc,
+			unaryWindingZeroFunc, unaryWindingSubtractFunc });
+#if OP_DEBUG
+	SetDebugWindingCallBacks(contour, { nullptr, 0 }, noDebugBitOper
+            OP_DEBUG_DUMP_PARAMS(unaryWindingDumpInFunc, unaryWindingDumpOutFunc, noDumpFunc)
+            OP_DEBUG_IMAGE_PARAMS(noWindingImageOutFunc, noNativePathFunc,
+            noDebugGetDrawFunc, noDebugSetDrawFunc, noIsOppFunc)
+    );
+#endif
+    OpPoint contour1[] { { 2, 0 }, { 1, 2 }, { 0, 2 }, { 1, 2 }, { 2, 3 }, { 2, 0 } };
+    AddQuads(contour, { &contour1[0], quadSize, quadType } );
+    Add(     contour, { &contour1[3], lineSize, lineType } );
+    Add(     contour, { &contour1[4], lineSize, lineType } );
+    OpPoint contour2[] { { 0, 0 }, { 1, 1 }, { 1, 3 }, { 0, 3 }, { 1, 3 }, { 0, 0 } };
+    Add(     contour, { &contour2[0], lineSize, lineType } );
+    AddQuads(contour, { &contour2[1], quadSize, quadType } );
+    Add(     contour, { &contour2[4], lineSize, lineType } );
+	Normalize(context);
+    Resolve(context, nullptr);
+	ContextError error = Error(context);
+    if (peak)
+        *peak = PeakMemory(context);
+    ResetContext(context);  // context must be usable after any error
+    if (ContextError::none != Error(context))
+        exit(1);
+    DeleteContext(context);
+    return error;
+}
+
+void testAllocatorCallBacks() {
+    using namespace PathOpsV0Lib;
+    std::vector<char> buffer(4 * 1024 * 1024);
+    TestArena large { buffer.data(), buffer.size(), 0, 0, 0 };
+    if (ContextError::none != testArenaResolve(large) || large.allocated != large.freed)
+        exit(1);
+    // running out of blocks at any allocation must stop resolve and release all storage
+    for (int limit = 1; limit < large.allocated; ++limit) {
+        TestArena exhausted { buffer.data(), buffer.size(), 0, 0, 0, limit };
+        if (ContextError::memory != testArenaResolve(exhausted) 
+                || exhausted.allocated != exhausted.freed)
+            exit(1);
+    }
+    TestArena small { buffer.data(), 1024, 0, 0, 0 };  // too small for any block
+    if (ContextError::memory != testArenaResolve(small) || small.allocated != small.freed)
+        exit(1);
+    size_t peak = 0;
+    TestArena unlimited { buffer.data(), buffer.size(), 0, 0, 0 };
+    if (ContextError::none != testArenaResolve(unlimited, 0, &peak) || !peak)
+        exit(1);
+    size_t budget = peak / 2;
+    TestArena limited { buffer.data(), buffer.size(), 0, 0, 0 };
+    if (ContextError::memory != testArenaResolve(limited, budget, &peak) || peak > budget)
+        exit(1);
+}
+
+int cancelPolls;
+
+bool testCancel(PathOpsV0Lib::Context* ) {
+    return --cancelPolls < 0;
+}
+
+// cancelling at any poll must stop resolve with timeout and release all storage
+void testCancelCallBack() {
+    using namespace PathOpsV0Lib;
+    std::vector<char> buffer(4 * 1024 * 1024);
+    const int neverCancel = 1000000;
+    cancelPolls = neverCancel;
+    TestArena uncancelled { buffer.data(), buffer.size(), 0, 0, 0 };
+    if (ContextError::none != testArenaResolve(uncancelled, 0, nullptr, testCancel))
+        exit(1);
+    int pollCount = neverCancel - cancelPolls;
+    if (!pollCount)
+        exit(1);
+    for (int poll = 0; poll < pollCount; ++poll) {
+        cancelPolls = poll;
+        TestArena cancelled { buffer.data(), buffer.size(), 0, 0, 0 };
+        if (ContextError::timeout != testArenaResolve(cancelled, 0, nullptr, testCancel)
+                || cancelled.allocated != cancelled.freed)
+            exit(1);
+    }
+}
+
 void testNewInterface() {
     using namespace PathOpsV0Lib;
 
@@ -101,9 +224,18 @@ void testNewInterface() {
 	Normalize(context);
     Resolve(context, nullptr);
 	ContextError error = Error(context);
+    ContextStats stats = GetStats(context);
+    if (stats.segments < 6 || stats.edges < stats.segments || !stats.intersections 
+            || !stats.curveCurvePairs || !stats.edgeBytes || !stats.sectBytes)
+        exit(1);
+    ResetStats(context);
+    if (GetStats(context).segments || GetStats(context).edgeBytes)
+        exit(1);
     DeleteContext(context);
     if (ContextError::none != error)
         exit(1);
+    testAllocatorCallBacks();
+    testCancelCallBack();
 }
 
 #if OP_DEBUG && OP_TINY_TEST
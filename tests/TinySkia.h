@@ -196,6 +196,7 @@ public:
 			SkPathDirection dir = SkPathDirection::kCW);
 	void arcTo(const SkRect& , float startAngle, float sweepAngle, bool forceMoveTo);
 	int countPoints() const;
+	void incReserve(int extraPtCount) { path.reserve(path.size() + extraPtCount); }
 	bool isInverseFillType() const { return SkPathFillType::kInverseWinding == fFillType
 			|| SkPathFillType::kInverseEvenOdd == fFillType; }
 	const SkRect& getBounds() const;